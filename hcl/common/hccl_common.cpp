@@ -48,6 +48,20 @@ hcclResult_t HCCL_API_CALL hcclCommInitAll_impl(hcclComm_t* comm, int ndev, cons
     
 }
 
+hcclResult_t HCCL_API_CALL hcclCommSplit_impl(hcclComm_t comm, int color, int key, hcclComm_t* newcomm)
+{
+    
+        return (HclGen2::hcclCommSplit_impl(comm, color, key, newcomm));
+    
+}
+
+hcclResult_t HCCL_API_CALL hcclCommDup_impl(hcclComm_t comm, hcclComm_t* newcomm)
+{
+    
+        return (HclGen2::hcclCommDup_impl(comm, newcomm));
+    
+}
+
 hcclResult_t HCCL_API_CALL hcclCommFinalize_impl(hcclComm_t comm)
 {
     
@@ -118,6 +132,13 @@ hcclResult_t HCCL_API_CALL hcclCommUserRank_impl(hcclComm_t comm, int* rank)
     
 }
 
+hcclResult_t HCCL_API_CALL hcclCommTopologyRank_impl(hcclComm_t comm, int* rank)
+{
+    
+        return (HclGen2::hcclCommTopologyRank_impl(comm, rank));
+    
+}
+
 int HCCL_API_CALL hcclLookupDMABuff_impl(uint64_t addr, uint64_t size, int* fd)
 {
     
@@ -152,6 +173,18 @@ hcclResult_t HCCL_API_CALL hcclAllReduce_impl(const void*     sendbuff,
     
 }
 
+hcclResult_t HCCL_API_CALL hcclAllReduceMulti_impl(const hcclAllReduceEntry_t* entries,
+                                                   size_t                      numEntries,
+                                                   hcclDataType_t              datatype,
+                                                   hcclRedOp_t                 reduceOp,
+                                                   hcclComm_t                  comm,
+                                                   synStreamHandle             stream_handle)
+{
+    
+        return (HclGen2::hcclAllReduceMulti_impl(entries, numEntries, datatype, reduceOp, comm, stream_handle));
+    
+}
+
 hcclResult_t HCCL_API_CALL hcclReduce_impl(const void*     sendbuff,
                                            void*           recvbuff,
                                            size_t          count,
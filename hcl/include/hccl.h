@@ -72,6 +72,21 @@ hcclResult_t hcclCommInitRank(hcclComm_t* comm, int nranks, hcclUniqueId commId,
  * Order of devlist defines user-order of processors within the communicator. */
 hcclResult_t hcclCommInitAll(hcclComm_t* comm, int ndev, const int* devlist);
 
+/* Creates new communicators out of the ranks of an existing communicator.
+ * Must be called by all ranks of comm. Ranks passing the same color are grouped
+ * into the same new communicator, ordered by key (ties are broken by the rank in comm).
+ * Ranks passing HCCL_SPLIT_NOCOLOR do not join any communicator and get a NULL newcomm.
+ * The bootstrap Id of every new communicator is generated and distributed through comm,
+ * so no hcclGetUniqueId call or out of band Id broadcast is needed.
+ * This is a convenience function: every new communicator still runs the full hcclCommInitRank
+ * initialization (bootstrap handshakes, QP creation and connection setup), none of the parent's
+ * connections are reused. */
+hcclResult_t hcclCommSplit(hcclComm_t comm, int color, int key, hcclComm_t* newcomm);
+
+/* Creates a new communicator with the same ranks as comm.
+ * Must be called by all ranks of comm. Like hcclCommSplit, it runs a full communicator initialization. */
+hcclResult_t hcclCommDup(hcclComm_t comm, hcclComm_t* newcomm);
+
 /* Waits for all submitted work of communicator to be done.
  * By doing so, prepares communicator for destruction. */
 hcclResult_t hcclCommFinalize(hcclComm_t comm);
@@ -99,6 +114,13 @@ hcclResult_t hcclCommSynDevice(hcclComm_t comm, int* device);
 /* Returns the user-ordered "rank" associated with the communicator. */
 hcclResult_t hcclCommUserRank(hcclComm_t comm, int* rank);
 
+/* Returns the rank of the caller in the topology-aware order of comm's ranks.
+ * In that order the ranks of a box are contiguous and ordered by their host NIC NUMA node and module,
+ * so scale-up groups match the boxes and scale-out peers line up on the same ports.
+ * Must be called by all ranks of comm. Passing the result as key to hcclCommSplit
+ * creates a communicator that uses this order. */
+hcclResult_t hcclCommTopologyRank(hcclComm_t comm, int* rank);
+
 /* Returns FD for HBM memory region if it was registered for gaudi-direct. */
 int hcclLookupDMABuff(uint64_t addr, uint64_t size, int* fd);
 
@@ -183,6 +205,24 @@ hcclResult_t hcclAllReduce(const void*    sendbuff,
                            hcclComm_t     comm,
                            void*          stream_handle);
 
+/*
+ * Fused All-Reduce
+ *
+ * Performs an All-Reduce over each of the numEntries (sendbuff, recvbuff, count)
+ * entries. All entries share the same datatype and reduceOp. Entries that are
+ * contiguous in memory with their predecessor (in both sendbuff and recvbuff)
+ * are reduced as a single collective, and the whole list is submitted as one
+ * group, so the per-call overhead is paid once per bucket list.
+ *
+ * In-place operation will happen for entries where sendbuff == recvbuff.
+ */
+hcclResult_t hcclAllReduceMulti(const hcclAllReduceEntry_t* entries,
+                                size_t                      numEntries,
+                                hcclDataType_t              datatype,
+                                hcclRedOp_t                 reduceOp,
+                                hcclComm_t                  comm,
+                                void*                       stream_handle);
+
 /*
  * Reduce-Scatter
  *
@@ -101,4 +101,13 @@ struct hccl_functions_pointers
     hcclResult_t (*pfn_hcclGetVersionString)(char* pVersion, const unsigned len);
     hcclResult_t (*pfn_hcclCommFinalize)(hcclComm_t comm);
     hcclResult_t (*pfn_hcclDeviceInit)(void* device, void* context);
+    hcclResult_t (*pfn_hcclAllReduceMulti)(const hcclAllReduceEntry_t* entries,
+                                           size_t                      numEntries,
+                                           hcclDataType_t              datatype,
+                                           hcclRedOp_t                 reduceOp,
+                                           hcclComm_t                  comm,
+                                           synStreamHandle             stream_handle);
+    hcclResult_t (*pfn_hcclCommSplit)(hcclComm_t comm, int color, int key, hcclComm_t* newcomm);
+    hcclResult_t (*pfn_hcclCommDup)(hcclComm_t comm, hcclComm_t* newcomm);
+    hcclResult_t (*pfn_hcclCommTopologyRank)(hcclComm_t comm, int* rank);
 };
@@ -22,6 +22,9 @@
 
 #define hcclComm_t void*
 
+/* Color value for ranks that should not be part of any communicator created by hcclCommSplit */
+#define HCCL_SPLIT_NOCOLOR -1
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -87,9 +90,20 @@ typedef enum
     hcclFloat64  = 8,
     hcclDouble   = 8,
     hcclBfloat16 = 9,
+    hcclFp8E4M3  = 10, /* data movement only (no reductions), per-tensor scales are owned by the caller */
+    hcclFp8E5M2  = 11, /* data movement only (no reductions), per-tensor scales are owned by the caller */
     hcclNumTypes
 } hcclDataType_t;
 
+/* Single buffer descriptor of a fused (bucketed) All-Reduce */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct
+{
+    const void* sendbuff;
+    void*       recvbuff;
+    size_t      count;
+} hcclAllReduceEntry_t;
+
 typedef void (*hcclStreamCallback_t)(synStreamHandle stream, hcclResult_t result, void* userData);
 
 #ifdef __cplusplus
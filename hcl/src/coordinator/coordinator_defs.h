@@ -21,6 +21,8 @@
 #include "collective_logger.h"
 #include "interfaces/hcl_unique_sorted_vector.h"
 
+struct LatencyReportMessage;
+
 class IHcclCoordinatorClient
 {
 public:
@@ -43,6 +45,9 @@ public:
 
     virtual hcclResult_t sendCollectiveLogErr() = 0;
 
+    // Called from the latency stats poller thread, concurrently with the API thread
+    virtual hcclResult_t sendLatencyReport(const LatencyReportMessage& report) = 0;
+
     virtual hcclResult_t sendRecvFromRanks(UniqueSortedVector& nonPeerRemoteRanks,
                                            std::vector<void*>& recvBuffers,
                                            std::vector<void*>& sendBuffers,
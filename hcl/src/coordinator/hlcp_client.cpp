@@ -23,8 +23,9 @@ hlcp_client_t::hlcp_client_t(uint32_t nranks, HCL_Rank rank, const internal_uniq
 
     gcfg_.io_threads = GCFG_HCL_HLCP_CLIENT_IO_THREADS.value();
     gcfg_.op_timeout = GCFG_HCL_HLCP_OPS_TIMEOUT.value();
+    gcfg_.io_uring   = GCFG_HCL_HLCP_IO_URING.value();
 
-    if (!start(gcfg_.io_threads))
+    if (!start(gcfg_.io_threads, sockaddr_t(), gcfg_.io_uring))
     {
         VERIFY(false, "cannot start hlcp client");
         return;
@@ -76,6 +77,8 @@ void hlcp_client_t::on_command(hlcp_command_t& cmd, hlcp_t& connection)
     }
 
     close_connection(connection);
+
+    notify_event();
 }
 
 void hlcp_client_t::on_error(bool send, hlcp_command_t* cmd, const hlcp_packet_t& packet, hlcp_t& connection)
@@ -146,6 +149,8 @@ void hlcp_client_t::on_message(const hlcp_message_t& msg, hlcp_t& connection)
 
                     non_peers_[rank].synched = true;
                 }
+
+                notify_event();
             }
         }
         break;
@@ -162,7 +167,7 @@ bool hlcp_client_t::syncBetweenRanks()
 
     RET_ON_FALSE(send_to_srv(cmd));
 
-    wait_condition(cmd_sync_.completed_, gcfg_.op_timeout);
+    wait_event_condition(cmd_sync_.completed_, gcfg_.op_timeout);
 
     HLCP_INF("completed");
 
@@ -191,7 +196,7 @@ bool hlcp_client_t::commInitHandshake1(int nranks, RankInfoHeader& myRankInfo, r
 
     RET_ON_FALSE(send_to_srv(cmd));
 
-    wait_condition(cmd_comm_data_.completed_, gcfg_.op_timeout);
+    wait_event_condition(cmd_comm_data_.completed_, gcfg_.op_timeout);
 
     for (const auto& hdr : ranksInfo)
     {
@@ -220,7 +225,7 @@ bool hlcp_client_t::commInitHandshake2(int               nranks,
 
     RET_ON_FALSE(send_to_srv(cmd));
 
-    wait_condition(cmd_qps_conf_.completed_, gcfg_.op_timeout);
+    wait_event_condition(cmd_qps_conf_.completed_, gcfg_.op_timeout);
 
     HLCP_INF("completed");
 
@@ -280,6 +285,11 @@ bool hlcp_client_t::xchg_non_peer_data(const UniqueSortedVector& nonPeerRemoteRa
                                        size_t                    sendRecvBufSize,
                                        HCL_Comm                  comm)
 {
+    VERIFY(sendRecvBufSize <= sizeof(remote_device_conn_info_t::data),
+           "non peers data size {} exceeds {}",
+           sendRecvBufSize,
+           sizeof(remote_device_conn_info_t::data));
+
     uint32_t i = 0;
     for (const HCL_Rank remoteRank : nonPeerRemoteRanks)
     {
@@ -288,12 +298,14 @@ bool hlcp_client_t::xchg_non_peer_data(const UniqueSortedVector& nonPeerRemoteRa
         send_to_rank(remoteRank, cmd);
     }
 
-    wait_condition(non_peer_data_ready(nonPeerRemoteRanks, true), gcfg_.op_timeout);
+    wait_event_condition(non_peer_data_ready(nonPeerRemoteRanks, true), gcfg_.op_timeout);
 
+    // data is consumed, remote rank can send again after the following sync
     i = 0;
     for (const HCL_Rank remoteRank : nonPeerRemoteRanks)
     {
         std::memcpy(recvBuffers[i++], &non_peers_[remoteRank].data, sendRecvBufSize);
+        non_peers_[remoteRank].initialized = false;
     }
 
     return true;
@@ -315,7 +327,12 @@ bool hlcp_client_t::sync_non_peers(const HCL_Comm comm, const UniqueSortedVector
         send_to_rank(remoteRank, cmd);
     }
 
-    wait_condition(non_peer_data_ready(nonPeerRemoteRanks, false), gcfg_.op_timeout);
+    wait_event_condition(non_peer_data_ready(nonPeerRemoteRanks, false), gcfg_.op_timeout);
+
+    for (const HCL_Rank remoteRank : nonPeerRemoteRanks)
+    {
+        non_peers_[remoteRank].synched = false;
+    }
 
     return true;
 }
@@ -343,6 +360,15 @@ hcclResult_t hlcp_client_t::sendCollectiveLogErr()
     return hcclSuccess;
 }
 
+hcclResult_t hlcp_client_t::sendLatencyReport(const LatencyReportMessage& report)
+{
+    hlcp_cmd_latency_report_t cmd(report);
+
+    if (!send_to_srv(cmd)) return hcclInternalError;
+
+    return hcclSuccess;
+}
+
 bool hlcp_client_t::send_to_srv(const hlcp_command_t& cmd)
 {
     socket_t socket;
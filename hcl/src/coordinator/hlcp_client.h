@@ -49,6 +49,7 @@ public:  // IHcclCoordinatorClient
                                            const HCL_Rank         peer,
                                            const HCL_Rank         root) override;
     virtual hcclResult_t sendCollectiveLogErr() override;
+    virtual hcclResult_t sendLatencyReport(const LatencyReportMessage& report) override;
 
     virtual hcclResult_t sendRecvFromRanks(UniqueSortedVector& nonPeerRemoteRanks,
                                            std::vector<void*>& recvBuffers,
@@ -111,6 +112,7 @@ private:
     {
         uint64_t io_threads = 2;
         uint64_t op_timeout = 120;  // sec
+        bool     io_uring   = false;
     } gcfg_;
 
     // commands we will receive in our srv socket
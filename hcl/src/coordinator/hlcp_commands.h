@@ -2,6 +2,7 @@
 #include "protocol.h"
 #include "hcl_types.h"
 #include "hccl_internal_defs.h"
+#include "infra/hcl_latency_stats.h"
 
 template<cmdid_t ID, class PARAM = uint32_t, class PAYLOAD = void*>
 class _hlcp_command_t : public hlcp_command_t
@@ -59,6 +60,10 @@ using hlcp_cmd_non_peers_t       = _hlcp_command_t<HLCP_NON_PEERS, HCL_Rank>;
 constexpr cmdid_t HLCP_LOG_MSG = HLCP_BASE_CMD_ID + 50;  // client -> server
 using hlcp_cmd_log_msg_t       = _hlcp_command_t<HLCP_LOG_MSG, CollectiveLogMessage>;
 
+// collective latency report
+constexpr cmdid_t HLCP_LATENCY_REPORT = HLCP_BASE_CMD_ID + 51;  // client -> server
+using hlcp_cmd_latency_report_t       = _hlcp_command_t<HLCP_LATENCY_REPORT, LatencyReportMessage>;
+
 // sync (rendezvous)
 constexpr cmdid_t HLCP_SYNC = HLCP_BASE_CMD_ID + 60;                 // client -> server; client -> client
 using hlcp_cmd_sync_t       = _hlcp_command_t<HLCP_SYNC, HCL_Rank>;  //
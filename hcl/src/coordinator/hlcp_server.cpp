@@ -12,12 +12,13 @@
 
 #include "hlcp_server.h"
 
-hlcp_server_t::hlcp_server_t(const sockaddr_t& ipaddr)
+hlcp_server_t::hlcp_server_t(const sockaddr_t& ipaddr) : straggler_detector_(GCFG_HCL_STRAGGLER_FACTOR.value())
 {
     gcfg_.io_threads = GCFG_HCL_HLCP_SERVER_IO_THREADS.value();
     gcfg_.op_timeout = GCFG_HCL_HLCP_OPS_TIMEOUT.value();
+    gcfg_.io_uring   = GCFG_HCL_HLCP_IO_URING.value();
 
-    if (!start(gcfg_.io_threads, ipaddr))
+    if (!start(gcfg_.io_threads, ipaddr, gcfg_.io_uring))
     {
         LOG_HCL_CRITICAL(HCL,
                          "Failed to create coordinator server on {}. ({}: {})",
@@ -71,6 +72,7 @@ uint32_t hlcp_server_t::comm_init(uint32_t comm_size)
     gcfg_.send_threads = ceil((float)comm_size / (float)GCFG_HCL_HLCP_SERVER_SEND_THREAD_RANKS.value());
 
     collective_logger_.setCommSize(comm_size);
+    straggler_detector_.setCommSize(comm_size);
 
     ranks_headers_.resize(comm_size);
 
@@ -275,6 +277,15 @@ void hlcp_server_t::on_message(const hlcp_message_t& msg, hlcp_t& connection)
         }
         break;
 
+        case HLCP_LATENCY_REPORT:  // collective latency report
+        {
+            hlcp_cmd_latency_report_t command(msg);
+            close_connection(connection);
+
+            on_hlcp_latency_report(command);
+        }
+        break;
+
         case HLCP_SYNC:  // sync message
         {
             hlcp_cmd_sync_t command(msg);
@@ -370,3 +381,10 @@ void hlcp_server_t::on_hlcp_log_msg(const hlcp_cmd_log_msg_t& cmd)
         collective_logger_.processLogMessage(msg);
     }
 }
+
+void hlcp_server_t::on_hlcp_latency_report(const hlcp_cmd_latency_report_t& cmd)
+{
+    HLCP_DBG("rank {} latency report, window {}", cmd.param_.rank, cmd.param_.window);
+
+    straggler_detector_.processReport(cmd.param_);
+}
@@ -18,6 +18,7 @@
 #include "coordinator_defs.h"
 #include "coordinator.h"
 #include "hlcp_commands.h"
+#include "straggler_detector.h"
 
 using futex_t = FutexLock;
 
@@ -33,6 +34,7 @@ private:
         uint64_t io_threads   = 2;
         uint64_t op_timeout   = 120;
         uint32_t send_threads = 1;
+        bool     io_uring     = false;
     } gcfg_;
 
     counter_t cnt_synched_ranks_ = 0;
@@ -45,7 +47,8 @@ private:
     ranks_headers_t        ranks_headers_;
     remote_devices_array_t ranks_connections_;
 
-    CollectiveLogger collective_logger_;
+    CollectiveLogger  collective_logger_;
+    StragglerDetector straggler_detector_;
 
     uint32_t comm_init(uint32_t comm_size);
 
@@ -53,6 +56,7 @@ private:
     void on_hlcp_qps_conf(hlcp_cmd_qps_conf_t& cmd);
     void on_hlcp_sync(const hlcp_cmd_sync_t& cmd);
     void on_hlcp_log_msg(const hlcp_cmd_log_msg_t& cmd);
+    void on_hlcp_latency_report(const hlcp_cmd_latency_report_t& cmd);
 
     bool send_to_rank(HCL_Rank rank, const hlcp_command_t& cmd);
 
@@ -111,6 +111,49 @@ hcclResult_t HCCL_API_CALL hcclCommInitAll_Original(hcclComm_t* comm, int ndev,
     HCCL_API_EXIT(status)
 }
 
+hcclResult_t HCCL_API_CALL hcclCommSplit_Original(hcclComm_t comm, int color, int key, hcclComm_t* newcomm)
+{
+    HCCL_TRY
+    RETURN_ON_NULL_ARG(newcomm);
+    auto* hccl_comm = hccl_ctx.communicator(comm);
+    RETURN_ON_INVALID_HCCL_COMM(hccl_comm);
+
+    HCL_API_LOG_ENTRY("(comm={}, color={}, key={})", comm, color, key);
+    hcclResult_t res = hccl_ctx.comm_split(comm, color, key, newcomm);
+    if (res == hcclSuccess)
+    {
+        HCL_API_LOG_ENTRY("(newcomm={})", *newcomm);
+    }
+    else
+    {
+        LOG_ERR(HCL_API, "hcclCommSplit_Original failed({})", res);
+    }
+
+    HCCL_API_EXIT(res)
+}
+
+hcclResult_t HCCL_API_CALL hcclCommDup_Original(hcclComm_t comm, hcclComm_t* newcomm)
+{
+    HCCL_TRY
+    RETURN_ON_NULL_ARG(newcomm);
+    auto* hccl_comm = hccl_ctx.communicator(comm);
+    RETURN_ON_INVALID_HCCL_COMM(hccl_comm);
+
+    HCL_API_LOG_ENTRY("(comm={})", comm);
+    // same color for all ranks, keyed by the current rank to keep the rank order
+    hcclResult_t res = hccl_ctx.comm_split(comm, 0, hccl_comm->user_rank(), newcomm);
+    if (res == hcclSuccess)
+    {
+        HCL_API_LOG_ENTRY("(newcomm={})", *newcomm);
+    }
+    else
+    {
+        LOG_ERR(HCL_API, "hcclCommDup_Original failed({})", res);
+    }
+
+    HCCL_API_EXIT(res)
+}
+
 hcclResult_t HCCL_API_CALL hcclCommFinalize_Original(hcclComm_t comm)
 {
     HCCL_TRY
@@ -185,6 +228,22 @@ hcclResult_t HCCL_API_CALL hcclCommUserRank_Original(hcclComm_t comm, int* rank)
     HCCL_API_EXIT(status)
 }
 
+hcclResult_t HCCL_API_CALL hcclCommTopologyRank_Original(hcclComm_t comm, int* rank)
+{
+    HCCL_TRY
+    RETURN_ON_NULL_ARG(rank);
+    auto* hccl_comm = hccl_ctx.communicator(comm);
+    RETURN_ON_INVALID_HCCL_COMM(hccl_comm);
+
+    HCL_API_LOG_ENTRY("(comm={})", comm);
+    hcclResult_t status = hccl_comm->comm_topology_rank(rank);
+    if (status != hcclSuccess)
+    {
+        LOG_ERR(HCL_API, "hcclCommTopologyRank_Original failed({})", status);
+    }
+    HCCL_API_EXIT(status)
+}
+
 int HCCL_API_CALL hcclLookupDMABuff_Original(uint64_t addr, uint64_t size, int* fd)
 {
     HCCL_TRY
@@ -249,6 +308,39 @@ hcclResult_t HCCL_API_CALL hcclAllReduce_Original(const void*     sendbuff,
     HCCL_API_EXIT(status)
 }
 
+hcclResult_t HCCL_API_CALL hcclAllReduceMulti_Original(const hcclAllReduceEntry_t* entries,
+                                                       size_t                      numEntries,
+                                                       hcclDataType_t              datatype,
+                                                       hcclRedOp_t                 reduceOp,
+                                                       hcclComm_t                  comm,
+                                                       synStreamHandle             stream_handle)
+{
+    HCCL_TRY
+    auto* hccl_comm = hccl_ctx.communicator(comm);
+    RETURN_ON_NULL_ARG(entries);
+    RETURN_ON_INVALID_ARG(numEntries == 0, numEntries, "Cannot be zero.");
+    for (size_t i = 0; i < numEntries; i++)
+    {
+        RETURN_ON_INVALID_ADDR(entries[i].sendbuff);
+        RETURN_ON_INVALID_ADDR(entries[i].recvbuff);
+    }
+    RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_REDUCTION_OP(reduceOp);
+    RETURN_ON_INVALID_STREAM(stream_handle);
+
+    uint8_t apiId = hccl_ctx.generateApiId();
+
+    // report collective log
+    for (size_t i = 0; i < numEntries; i++)
+    {
+        HCL_COLLECTIVE_LOG(eHCLAllReduce, entries[i].count, datatype, reduceOp, -1, -1);
+    }
+
+    hcclResult_t status =
+        hccl_comm->allreduce_multi(entries, numEntries, datatype, reduceOp, stream_handle, eHCCLAPICall, apiId);
+    HCCL_API_EXIT(status)
+}
+
 hcclResult_t HCCL_API_CALL hcclReduce_Original(const void*     sendbuff,
                                                void*           recvbuff,
                                                size_t          count,
@@ -302,7 +394,7 @@ hcclResult_t HCCL_API_CALL hcclBroadcast_Original(const void*     sendbuff,
     auto* hccl_comm = hccl_ctx.communicator(comm);
     RETURN_ON_INVALID_ADDR(sendbuff);
     RETURN_ON_INVALID_ADDR(recvbuff);
-    RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_DATA_MOVEMENT_TYPE(datatype);
     RETURN_ON_INVALID_RANK(root, hccl_comm->getCommSize());
     RETURN_ON_INVALID_STREAM(stream_handle);
 
@@ -327,7 +419,7 @@ hcclResult_t HCCL_API_CALL hcclAllGather_Original(const void*     sendbuff,
     auto* hccl_comm = hccl_ctx.communicator(comm);
     RETURN_ON_INVALID_ADDR(sendbuff);
     RETURN_ON_INVALID_ADDR(recvbuff);
-    RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_DATA_MOVEMENT_TYPE(datatype);
     RETURN_ON_INVALID_STREAM(stream_handle);
 
     uint8_t apiId = hccl_ctx.generateApiId();
@@ -364,7 +456,7 @@ hcclResult_t hcclAlltoAll_Original(const void*     sendbuff,
     auto* hccl_comm = hccl_ctx.communicator(comm);
     RETURN_ON_INVALID_ADDR(sendbuff);
     RETURN_ON_INVALID_ADDR(recvbuff);
-    RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_DATA_MOVEMENT_TYPE(datatype);
     RETURN_ON_INVALID_STREAM(stream_handle);
 
     uint8_t apiId = hccl_ctx.generateApiId();
@@ -406,7 +498,7 @@ hcclResult_t HCCL_API_CALL hcclSend_Original(const void*     sendbuff,
     HCCL_TRY
     auto* hccl_comm = hccl_ctx.communicator(comm);
     RETURN_ON_INVALID_ADDR(sendbuff);
-    RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_DATA_MOVEMENT_TYPE(datatype);
     RETURN_ON_INVALID_HCCL_COMM(hccl_comm);
     RETURN_ON_INVALID_STREAM(stream_handle);
     RETURN_ON_RANK_CHECK(peer, hccl_comm);
@@ -429,7 +521,7 @@ hcclResult_t HCCL_API_CALL hcclRecv_Original(void*           recvbuff,
     HCCL_TRY
     auto* hccl_comm = hccl_ctx.communicator(comm);
     RETURN_ON_INVALID_ADDR(recvbuff);
-    RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_DATA_MOVEMENT_TYPE(datatype);
     RETURN_ON_INVALID_HCCL_COMM(hccl_comm);
     RETURN_ON_INVALID_STREAM(stream_handle);
     RETURN_ON_RANK_CHECK(peer, hccl_comm);
@@ -636,7 +728,11 @@ static struct hccl_functions_pointers default_functions_pointers_table = {
     .pfn_hcclDfaUpdateState             = hcclDfaUpdateState_Original,
     .pfn_hcclGetVersionString           = hcclGetVersionString_Original,
     .pfn_hcclCommFinalize               = hcclCommFinalize_Original,
-    .pfn_hcclDeviceInit                 = hcclDeviceInit_Original};
+    .pfn_hcclDeviceInit                 = hcclDeviceInit_Original,
+    .pfn_hcclAllReduceMulti             = hcclAllReduceMulti_Original,
+    .pfn_hcclCommSplit                  = hcclCommSplit_Original,
+    .pfn_hcclCommDup                    = hcclCommDup_Original,
+    .pfn_hcclCommTopologyRank           = hcclCommTopologyRank_Original};
 // functions_pointers_table will maintain the current functions pointers table
 // Initialized to the original functions
 static struct hccl_functions_pointers* functions_pointers_table = &default_functions_pointers_table;
@@ -730,6 +826,16 @@ hcclResult_t HCCL_API_CALL hcclCommInitAll_impl(hcclComm_t* comm, int ndev, cons
     return (*functions_pointers_table->pfn_hcclCommInitAll)(comm, ndev, devlist);
 }
 
+hcclResult_t HCCL_API_CALL hcclCommSplit_impl(hcclComm_t comm, int color, int key, hcclComm_t* newcomm)
+{
+    return (*functions_pointers_table->pfn_hcclCommSplit)(comm, color, key, newcomm);
+}
+
+hcclResult_t HCCL_API_CALL hcclCommDup_impl(hcclComm_t comm, hcclComm_t* newcomm)
+{
+    return (*functions_pointers_table->pfn_hcclCommDup)(comm, newcomm);
+}
+
 hcclResult_t HCCL_API_CALL hcclCommFinalize_impl(hcclComm_t comm)
 {
     HCL_API_LOG_ENTRY("(&comm={:p})", (void*)comm);
@@ -795,6 +901,11 @@ hcclResult_t HCCL_API_CALL hcclCommUserRank_impl(hcclComm_t comm, int* rank)
     return (*functions_pointers_table->pfn_hcclCommUserRank)(comm, rank);
 }
 
+hcclResult_t HCCL_API_CALL hcclCommTopologyRank_impl(hcclComm_t comm, int* rank)
+{
+    return (*functions_pointers_table->pfn_hcclCommTopologyRank)(comm, rank);
+}
+
 int HCCL_API_CALL hcclLookupDMABuff_impl(uint64_t addr, uint64_t size, int* fd)
 {
     HCL_API_LOG_ENTRY("(&addr={:p}, &size={:p})", (void*)addr, (void*)size);
@@ -869,6 +980,38 @@ hcclResult_t HCCL_API_CALL hcclAllReduce_impl(const void*     sendbuff,
                  ->pfn_hcclAllReduce)(sendbuff, recvbuff, count, datatype, reduceOp, comm, stream_handle);
 }
 
+hcclResult_t HCCL_API_CALL hcclAllReduceMulti_impl(const hcclAllReduceEntry_t* entries,
+                                                   size_t                      numEntries,
+                                                   hcclDataType_t              datatype,
+                                                   hcclRedOp_t                 reduceOp,
+                                                   hcclComm_t                  comm,
+                                                   synStreamHandle             stream_handle)
+{
+    auto* hccl_comm = hccl_ctx.communicator(comm);
+    RETURN_ON_INVALID_HCCL_COMM(hccl_comm);
+    hccl_comm->incCollectiveCtr();
+
+    HCL_API_LOG_ENTRY("rank={}/{}, oam={}, (entries={:p}, numEntries={}, datatype={}, reduceOp={}, "
+                      "uniqId={}, stream_handle={:p}) - "
+                      "collective#=0x{:x}",
+                      hccl_comm->user_rank(),
+                      hccl_comm->getCommSize(),
+                      hccl_device()->getHwModuleId(),
+                      (void*)entries,
+                      numEntries,
+                      to_string(datatype),
+                      to_string(reduceOp),
+                      hccl_comm->getCommUniqueId(),
+                      (void*)stream_handle,
+                      hccl_comm->getCollectiveCtr());
+
+    hcclResult_t status = syncHCLStreamHandle(stream_handle);
+    if (status != hcclSuccess) return status;
+
+    return (*functions_pointers_table
+                 ->pfn_hcclAllReduceMulti)(entries, numEntries, datatype, reduceOp, comm, stream_handle);
+}
+
 hcclResult_t HCCL_API_CALL hcclReduce_impl(const void*     sendbuff,
                                            void*           recvbuff,
                                            size_t          count,
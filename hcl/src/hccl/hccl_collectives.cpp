@@ -10,8 +10,10 @@
  *
  ******************************************************************************/
 
+#include <algorithm>                                // for min, max
 #include <cstddef>                                  // for size_t
 #include <cstdint>                                  // for uint64_t, int64_t
+#include <functional>                               // for function
 #include <vector>                                   // for vector
 #include "hccl_communicator.h"                      // for hccl_communicator
 #include "hccl_internal_defs.h"                     // for hcclOpParams, eHCCL...
@@ -24,6 +26,8 @@
 #include "hcl_log_manager.h"                        // for LOG_TRACE
 #include "synapse_api_types.h"                      // for synStreamHandle
 #include "hcl_dynamic_communicator.h"
+#include "hcl_math_utils.h"            // for div_round_up
+#include "infra/hcl_latency_stats.h"  // for ScopedLatencyOp
 
 hcclResult_t hccl_communicator::allreduce(const void*     sendbuff,
                                           void*           recvbuff,
@@ -48,6 +52,81 @@ hcclResult_t hccl_communicator::allreduce(const void*     sendbuff,
     return hccl_device().collective_call(params);
 }
 
+hcclResult_t hccl_communicator::allreduce_multi(const hcclAllReduceEntry_t* entries,
+                                                size_t                      numEntries,
+                                                hcclDataType_t              dataType,
+                                                hcclRedOp_t                 reduceOp,
+                                                synStreamHandle             stream_handle,
+                                                const uint32_t              flags,
+                                                uint8_t                     apiId)
+{
+    // Coalesce entries that directly follow their predecessor in both send and recv buffers (e.g. gradients carved
+    // out of a single flat bucket). Each coalesced run is sliced as one collective, so small tensors share slices of
+    // the intermediate buffers instead of each occupying a (mostly empty) slice of its own.
+    const uint64_t                   typeSize = dataTypeSizeInBytes(dataType);
+    std::vector<HclCollectiveParams> runs;
+    runs.reserve(numEntries);
+
+    for (size_t i = 0; i < numEntries; i++)
+    {
+        const hcclAllReduceEntry_t& entry = entries[i];
+        if (entry.count == 0) continue;
+
+        const uint64_t sendAddr = reinterpret_cast<uint64_t>(entry.sendbuff);
+        const uint64_t recvAddr = reinterpret_cast<uint64_t>(entry.recvbuff);
+
+        if (runs.size() > 0)
+        {
+            HclCollectiveParams& last    = runs.back();
+            const uint64_t       runSize = last.m_count * typeSize;
+            if (last.m_sendBufferAddr + runSize == sendAddr && last.m_recvBufferAddr + runSize == recvAddr)
+            {
+                last.m_count += entry.count;
+                continue;
+            }
+        }
+
+        runs.emplace_back(eHCLAllReduce,
+                          stream_handle,
+                          sendAddr,
+                          recvAddr,
+                          entry.count,
+                          dataType,
+                          *m_comm,
+                          apiId,
+                          flags,
+                          reduceOp);
+    }
+
+    LOG_HCL_TRACE(HCL, "Fused allreduce: {} entries coalesced into {} collectives", numEntries, runs.size());
+
+    if (runs.size() == 1)
+    {
+        return hccl_device().collective_call(runs.front());
+    }
+
+    // Submit the remaining runs as a single group, so dependency checking is done once for the whole list and the
+    // collectives are issued back to back under the same stream submission.
+    hcclResult_t res = hccl_device().group(true);
+    if (res != hcclSuccess)
+    {
+        return res;
+    }
+
+    for (HclCollectiveParams& params : runs)
+    {
+        res = hccl_device().collective_call(params);
+        if (res != hcclSuccess)
+        {
+            LOG_HCL_ERR(HCL, "Fused allreduce: collective call failed ({})", res);
+            break;
+        }
+    }
+
+    hcclResult_t groupEndRes = hccl_device().group(false);
+    return res != hcclSuccess ? res : groupEndRes;
+}
+
 hcclResult_t hccl_communicator::reduce(const void*     sendbuff,
                                        void*           recvbuff,
                                        size_t          count,
@@ -135,6 +214,11 @@ hcclResult_t hccl_communicator::broadcast(const void*     sendbuff,
                                           const uint32_t  flags,
                                           uint8_t         apiId)
 {
+    if (usePipelinedBroadcast(count, dataType))
+    {
+        return pipelinedBroadcast(sendbuff, recvbuff, count, dataType, root, stream_handle, apiId);
+    }
+
     HclCollectiveParams params(eHCLBroadcast,
                                stream_handle,
                                (uint64_t)sendbuff,
@@ -170,3 +254,192 @@ hcclResult_t hccl_communicator::allgather(const void*     sendBuff,
 
     return hccl_device().collective_call(params);
 }
+
+bool hccl_communicator::usePipelinedBroadcast(size_t count, hcclDataType_t dataType)
+{
+    const uint64_t minSize = m_comm->getConfig().bcastPipelineMinSize;
+    if (minSize == 0 || count * dataTypeSizeInBytes(dataType) < minSize)
+    {
+        return false;
+    }
+
+    // Each phase of the chain is a group of its own, inside a user group they would all be merged into one and the
+    // forwarded slices would race their reception, so a grouped broadcast takes the regular path
+    if (hccl_device().in_group())
+    {
+        return false;
+    }
+
+    // The chain runs per scaleup-group lane, so every group must be full and every lane must hold data
+    const uint32_t scaleupGroupSize = m_comm->getScaleupGroupSize();
+    if (scaleupGroupSize == 0 || m_commSize % scaleupGroupSize != 0 || count < scaleupGroupSize)
+    {
+        return false;
+    }
+
+    return m_commSize / scaleupGroupSize >= m_comm->getConfig().bcastPipelineMinBoxes;
+}
+
+hcclResult_t hccl_communicator::pipelinedBroadcast(const void*     sendbuff,
+                                                   void*           recvbuff,
+                                                   size_t          count,
+                                                   hcclDataType_t  dataType,
+                                                   int             root,
+                                                   synStreamHandle streamHandle,
+                                                   uint8_t         apiId)
+{
+    // Chain-of-boxes broadcast:
+    // 1. root scatters the buffer to the ranks of its scaleup group, one lane per rank
+    // 2. each lane is forwarded box to box (starting at root box) over scaleout, sliced so every box in the chain
+    //    forwards slice j while receiving slice j + 1 - all scaleout ports are busy and depth is independent of
+    //    the number of boxes for large buffers
+    // 3. ranks of every scaleup group all-gather the lanes
+    // Send/recv pairs are matched in submission order, so all ranks submit the phases in the same order.
+    const uint64_t typeSize         = dataTypeSizeInBytes(dataType);
+    const uint32_t scaleupGroupSize = m_comm->getScaleupGroupSize();
+    const uint32_t numBoxes         = m_commSize / scaleupGroupSize;
+    const uint32_t myBox            = m_rank / scaleupGroupSize;
+    const uint32_t myLane           = m_rank % scaleupGroupSize;
+    const uint32_t rootBox          = root / scaleupGroupSize;
+    const uint32_t chainPos         = (myBox + numBoxes - rootBox) % numBoxes;
+    const bool     isRoot           = (m_rank == (HCL_Rank)root);
+    const uint64_t laneCount        = div_round_up(count, scaleupGroupSize);
+    const uint64_t sliceCount       = std::max(m_comm->getConfig().bcastPipelineSliceSize / typeSize, (uint64_t)1);
+
+    auto laneOffset = [&](uint32_t lane) { return std::min(lane * laneCount, (uint64_t)count); };
+    auto laneSize   = [&](uint32_t lane) { return std::min(laneCount, count - laneOffset(lane)); };
+    auto boxRank    = [&](uint32_t box, uint32_t lane) { return (int)(box * scaleupGroupSize + lane); };
+    auto addr       = [&](const void* buff, uint64_t offset) { return (uint8_t*)buff + offset * typeSize; };
+
+    // All phases are recorded as one broadcast sample
+    ScopedLatencyOp latencyOp(m_comm->m_latencyStats, eHCLBroadcast);
+
+    hcclResult_t res = hcclSuccess;
+    auto         runGroup = [&](const std::function<hcclResult_t()>& body) {
+        res = hccl_device().group(true);
+        if (res != hcclSuccess) return;
+        res                      = body();
+        hcclResult_t groupEndRes = hccl_device().group(false);
+        res                      = res != hcclSuccess ? res : groupEndRes;
+    };
+
+    LOG_HCL_DEBUG(HCL,
+                  "Pipelined broadcast: count={}, root={}, boxes={}, chainPos={}, lane={}, sliceCount={}",
+                  count,
+                  root,
+                  numBoxes,
+                  chainPos,
+                  myLane,
+                  sliceCount);
+
+    // Phase 1 - scatter inside root box, root keeps the whole buffer
+    if (chainPos == 0)
+    {
+        runGroup([&]() {
+            hcclResult_t rc = hcclSuccess;
+            if (isRoot)
+            {
+                if (sendbuff != recvbuff)
+                {
+                    rc = hccl_send(sendbuff, count, dataType, root, streamHandle, apiId);
+                    if (rc == hcclSuccess) rc = hccl_receive(recvbuff, count, dataType, root, streamHandle, apiId);
+                }
+                for (uint32_t lane = 0; rc == hcclSuccess && lane < scaleupGroupSize; lane++)
+                {
+                    if (boxRank(rootBox, lane) == root || laneSize(lane) == 0) continue;
+                    rc = hccl_send(addr(sendbuff, laneOffset(lane)),
+                                   laneSize(lane),
+                                   dataType,
+                                   boxRank(rootBox, lane),
+                                   streamHandle,
+                                   apiId);
+                }
+            }
+            else if (laneSize(myLane) != 0)
+            {
+                rc = hccl_receive(addr(recvbuff, laneOffset(myLane)),
+                                  laneSize(myLane),
+                                  dataType,
+                                  root,
+                                  streamHandle,
+                                  apiId);
+            }
+            return rc;
+        });
+    }
+
+    // Phase 2 - sliced forwarding of my lane along the chain of boxes
+    const void*    laneSrc    = isRoot ? sendbuff : recvbuff;
+    const uint64_t myLaneSize = laneSize(myLane);
+    const uint64_t numSlices  = div_round_up(myLaneSize, sliceCount);
+    const bool     hasPrev    = chainPos > 0;
+    const bool     hasNext    = chainPos + 1 < numBoxes;
+    const int      prevRank   = boxRank((myBox + numBoxes - 1) % numBoxes, myLane);
+    const int      nextRank   = boxRank((myBox + 1) % numBoxes, myLane);
+
+    auto sliceOffset = [&](uint64_t slice) { return laneOffset(myLane) + slice * sliceCount; };
+    auto sliceSize   = [&](uint64_t slice) { return std::min(sliceCount, myLaneSize - slice * sliceCount); };
+
+    // Root box already holds the lane and sends slice j at step j, other boxes receive slice j and send slice j-1
+    const uint64_t numSteps =
+        (myLaneSize == 0) ? 0 : (hasPrev ? numSlices + (hasNext ? 1 : 0) : (hasNext ? numSlices : 0));
+    for (uint64_t step = 0; res == hcclSuccess && step < numSteps; step++)
+    {
+        runGroup([&]() {
+            hcclResult_t rc = hcclSuccess;
+            if (hasPrev && step < numSlices)
+            {
+                rc = hccl_receive(addr(recvbuff, sliceOffset(step)),
+                                  sliceSize(step),
+                                  dataType,
+                                  prevRank,
+                                  streamHandle,
+                                  apiId);
+            }
+            const uint64_t sendSlice = hasPrev ? step - 1 : step;
+            if (rc == hcclSuccess && hasNext && (!hasPrev || step > 0))
+            {
+                rc = hccl_send(addr(laneSrc, sliceOffset(sendSlice)),
+                               sliceSize(sendSlice),
+                               dataType,
+                               nextRank,
+                               streamHandle,
+                               apiId);
+            }
+            return rc;
+        });
+    }
+
+    // Phase 3 - all-gather of the lanes inside every scaleup group, root already holds the whole buffer
+    if (res == hcclSuccess)
+    {
+        runGroup([&]() {
+            hcclResult_t rc = hcclSuccess;
+            for (uint32_t lane = 0; rc == hcclSuccess && lane < scaleupGroupSize; lane++)
+            {
+                const int peer = boxRank(myBox, lane);
+                if (lane == myLane) continue;
+                if (myLaneSize != 0 && peer != root)
+                {
+                    rc = hccl_send(addr(laneSrc, laneOffset(myLane)), myLaneSize, dataType, peer, streamHandle, apiId);
+                }
+                if (rc == hcclSuccess && !isRoot && laneSize(lane) != 0)
+                {
+                    rc = hccl_receive(addr(recvbuff, laneOffset(lane)),
+                                      laneSize(lane),
+                                      dataType,
+                                      peer,
+                                      streamHandle,
+                                      apiId);
+                }
+            }
+            return rc;
+        });
+    }
+
+    if (res != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "Pipelined broadcast: send/recv call failed ({})", res);
+    }
+    return res;
+}
@@ -16,6 +16,7 @@
 #include <cstddef>               // for size_t, NULL
 #include <cstdint>               // for uint64_t, uint8_t, uin...
 #include <cstring>               // for memset
+#include <map>                   // for map
 #include <sstream>               // for basic_ostream::operator<<
 #include <unordered_map>         // for unordered_map, unorder...
 #include "hccl_helpers.h"        // for RETURN_ON_SYNAPSE_ERROR
@@ -37,9 +38,11 @@
 #include "synapse_common_types.h"        // for synStatus
 #include "hcl_math_utils.h"
 #include "platform/gaudi2/hcl_device.h"            // for HclDeviceGaudi2
-#include "platform/gen2_arch_common/server_def.h"  // for Gen2ArchServerDef
+#include "platform/gen2_arch_common/server_def.h"           // for Gen2ArchServerDef
+#include "platform/gen2_arch_common/server_connectivity.h"  // for Gen2ArchServerConnectivity
 
 #include "coordinator/hlcp_client.h"
+#include "topology_rank_order.h"  // for getTopologyRankOrder
 
 std::unordered_map<HCL_Comm, spHcclCoordinatorClient> g_hcclCordClient;
 
@@ -266,6 +269,11 @@ hcclResult_t hccl_communicator::initialize(const internal_unique_id_t* internal_
     RankInfoHeader header {.hcclRank = m_rank};
 
     hccl_device()->getDeviceConfig().fillDeviceInfo(header);
+    if (isScaleOutPortHealthCheckEnabled())
+    {
+        header.unhealthyScaleOutPorts = hccl_device()->getServerConnectivity().getLogicalScaleOutPorts(
+            hccl_device()->sampleUnhealthyScaleOutPorts());
+    }
 
     if (GCFG_HCL_ENABLE_HLCP.value())
     {
@@ -326,6 +334,31 @@ hcclResult_t hccl_communicator::initialize(const internal_unique_id_t* internal_
     // set dynamic comm size, mostly it is the hccl comm size
     // for G1 over host it is fixed to box size
     m_comm->init(m_commSize, rank, boxSize);
+    checkScaleOutPortHealth(hcclRankInfoHeaders);
+    if (m_comm->getConfig().latencyStats && !m_comm->getConfig().nullSubmit)
+    {
+        // Loopback ranks all run in this process, there is nothing to compare them with
+        CollectiveLatencyStats::ReportSender sender;
+        if (!isLoopbackMode())
+        {
+            spHcclCoordinatorClient coordClient = m_coordClient;
+            sender = [coordClient](const LatencyReportMessage& report) {
+                if (coordClient->sendLatencyReport(report) != hcclSuccess)
+                {
+                    LOG_WARN(HCL, "Failed to send latency report of collectives window {}", report.window);
+                }
+            };
+        }
+
+        hcl::Gen2ArchScalManager& scalManager = hccl_device()->getScalManager();
+        m_comm->m_latencyStats.start(
+            [&scalManager](unsigned archStreamId, uint64_t targetValue) {
+                return scalManager.streamQuery(archStreamId, targetValue);
+            },
+            sender,
+            rank,
+            GCFG_HCL_LATENCY_STATS_INTERVAL.value());
+    }
     rc = hccl_device()->onNewCommStart(hclCommId, m_commSize, config);
     if (rc != hcclSuccess)
     {
@@ -410,6 +443,9 @@ void hccl_communicator::updateRemoteDevices(std::vector<RemoteDeviceConnectionIn
 
 bool hccl_communicator::destroy()
 {
+    // finalize() synchronized the streams, so the last reports are sent before the coordinator client is destroyed
+    m_comm->m_latencyStats.stop();
+
     hccl_device()->destroyComm(*m_comm, false);
 
     m_coordClient->destroy();
@@ -429,11 +465,361 @@ void hccl_communicator::finalize()
     LOG_HCL_DEBUG(HCL, "Finalized");
 }
 
+/**
+ * @brief exchange a fixed size buffer with remote ranks over the communicator bootstrap connections
+ * @param remoteRanks - ranks to exchange with, excluding current rank
+ * @param sendBuffer - buffer sent to all remote ranks
+ * @param recvBuffers - per remote rank receive buffers, ordered as remoteRanks
+ * @param size - size of the send buffer and of each receive buffer
+ */
+hcclResult_t hccl_communicator::exchangeWithRanks(UniqueSortedVector& remoteRanks,
+                                                  void*               sendBuffer,
+                                                  std::vector<void*>& recvBuffers,
+                                                  size_t              size)
+{
+    if (remoteRanks.size() == 0)
+    {
+        return hcclSuccess;
+    }
+
+    std::vector<void*> sendBuffers(remoteRanks.size(), sendBuffer);
+    hcclResult_t       rc = m_coordClient->sendRecvFromRanks(remoteRanks, recvBuffers, sendBuffers, size, *m_comm);
+    if (rc != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "Exchange with remote ranks {} failed", remoteRanks);
+        return rc;
+    }
+
+    // make sure all remote ranks consumed the data before the next exchange
+    m_coordClient->synchronizeRemoteRanks(*m_comm, remoteRanks);
+
+    return rc;
+}
+
+template<typename T>
+static std::vector<void*> entryPointers(std::vector<T>& entries)
+{
+    std::vector<void*> pointers;
+    for (T& entry : entries)
+    {
+        pointers.push_back(&entry);
+    }
+    return pointers;
+}
+
+/**
+ * @brief exchange fixed size buffers between rank 0 and each other rank, the other ranks do not exchange among
+ *        themselves so the number of bootstrap messages grows linearly with the communicator size
+ * @param sendBuffers - rank 0: buffer to send to each rank, indexed by rank, other ranks: a single buffer for rank 0
+ * @param recvBuffers - rank 0: buffer to receive from each rank, indexed by rank, other ranks: a single buffer
+ * @param size - size of every buffer
+ */
+hcclResult_t hccl_communicator::exchangeWithRoot(const std::vector<void*>& sendBuffers,
+                                                 const std::vector<void*>& recvBuffers,
+                                                 size_t                    size)
+{
+    UniqueSortedVector remoteRanks;
+    std::vector<void*> remoteSendBuffers;
+    std::vector<void*> remoteRecvBuffers;
+    for (HCL_Rank rank = (m_rank == 0 ? 1 : 0); rank < (m_rank == 0 ? m_commSize : 1); rank++)
+    {
+        remoteRanks.insert_sorted(rank);
+        remoteSendBuffers.push_back(sendBuffers[rank]);
+        remoteRecvBuffers.push_back(recvBuffers[rank]);
+    }
+
+    if (remoteRanks.size() == 0)
+    {
+        return hcclSuccess;
+    }
+
+    hcclResult_t rc =
+        m_coordClient->sendRecvFromRanks(remoteRanks, remoteRecvBuffers, remoteSendBuffers, size, *m_comm);
+    if (rc != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "Exchange of rank({}) with rank 0 failed", m_rank);
+        return rc;
+    }
+
+    // make sure all remote ranks consumed the data before the next exchange
+    m_coordClient->synchronizeRemoteRanks(*m_comm, remoteRanks);
+
+    return rc;
+}
+
+/**
+ * @brief compute the rank mapping of the split communicators
+ *
+ * Colors and keys are gathered to rank 0, which orders every color group and sends each rank its new rank and size.
+ * @param roots - filled on rank 0 only: for every rank, the rank of its group's first member
+ */
+hcclResult_t hccl_communicator::splitRanks(int color, int key, split_rank_t& splitRank, std::vector<HCL_Rank>& roots)
+{
+    struct split_info_t
+    {
+        int color;
+        int key;
+    };
+
+    const bool isRoot = (m_rank == 0);
+    const int  peers  = isRoot ? m_commSize : 1;  // entries exchanged with rank 0, indexed by rank on rank 0
+
+    split_info_t              myInfo = {color, key};
+    std::vector<split_info_t> ranksInfo(peers, myInfo);
+    std::vector<split_rank_t> ranksSplit(peers, {-1, 0});
+    std::vector<split_rank_t> unused(peers);
+
+    hcclResult_t rc = exchangeWithRoot(std::vector<void*>(peers, &myInfo), entryPointers(ranksInfo), sizeof(myInfo));
+    if (rc != hcclSuccess) return rc;
+
+    if (isRoot)
+    {
+        std::map<int, std::vector<HCL_Rank>> groups;
+        roots.resize(m_commSize);
+        for (HCL_Rank rank = 0; rank < m_commSize; rank++)
+        {
+            roots[rank] = rank;
+            if (ranksInfo[rank].color != HCCL_SPLIT_NOCOLOR)
+            {
+                groups[ranksInfo[rank].color].push_back(rank);
+            }
+        }
+
+        for (auto& [groupColor, members] : groups)
+        {
+            // ranks are already ordered, so equal keys keep the parent rank order
+            std::stable_sort(members.begin(), members.end(), [&](HCL_Rank a, HCL_Rank b) {
+                return ranksInfo[a].key < ranksInfo[b].key;
+            });
+
+            for (unsigned newRank = 0; newRank < members.size(); newRank++)
+            {
+                ranksSplit[members[newRank]] = {(int)newRank, (int)members.size()};
+                roots[members[newRank]]      = members[0];
+            }
+            LOG_HCL_DEBUG(HCL,
+                          "Split color({}) has {} members, first is rank({})",
+                          groupColor,
+                          members.size(),
+                          members[0]);
+        }
+    }
+
+    rc = exchangeWithRoot(entryPointers(isRoot ? ranksSplit : unused),
+                          entryPointers(isRoot ? unused : ranksSplit),
+                          sizeof(split_rank_t));
+    if (rc != hcclSuccess) return rc;
+
+    splitRank = ranksSplit[0];
+
+    return rc;
+}
+
+/**
+ * @brief distribute the unique ID created by the first member of every split group to the other members, via rank 0
+ *
+ * Every rank takes part, including ranks without a color and first members that failed to create the ID, so an error
+ * reaches all members of the group instead of leaving them waiting for the ID.
+ * @param roots - from splitRanks, used on rank 0 only
+ * @param idResult - result of the unique ID creation on a group's first member, hcclSuccess on the other ranks
+ */
+hcclResult_t hccl_communicator::shareSplitUniqueId(const std::vector<HCL_Rank>& roots,
+                                                   hcclResult_t                 idResult,
+                                                   hcclUniqueId&                uniqueId)
+{
+    struct split_id_t
+    {
+        hcclResult_t         result;
+        internal_unique_id_t id;
+    };
+
+    const bool isRoot = (m_rank == 0);
+    const int  peers  = isRoot ? m_commSize : 1;  // entries exchanged with rank 0, indexed by rank on rank 0
+
+    split_id_t myId = {idResult, {}};
+    if (idResult == hcclSuccess)
+    {
+        memcpy(&myId.id, uniqueId.internal, sizeof(myId.id));
+    }
+
+    std::vector<split_id_t> ranksId(peers, myId);
+    std::vector<split_id_t> groupIds(peers, myId);
+    std::vector<split_id_t> unused(peers);
+
+    hcclResult_t rc = exchangeWithRoot(std::vector<void*>(peers, &myId), entryPointers(ranksId), sizeof(myId));
+    if (rc != hcclSuccess) return rc;
+
+    if (isRoot)
+    {
+        for (HCL_Rank rank = 0; rank < m_commSize; rank++)
+        {
+            groupIds[rank] = ranksId[roots[rank]];
+        }
+    }
+
+    rc = exchangeWithRoot(entryPointers(isRoot ? groupIds : unused),
+                          entryPointers(isRoot ? unused : groupIds),
+                          sizeof(split_id_t));
+    if (rc != hcclSuccess) return rc;
+
+    if (groupIds[0].result != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL,
+                    "First rank of the split group failed to create its unique ID, result({})",
+                    groupIds[0].result);
+        return groupIds[0].result;
+    }
+
+    memcpy(uniqueId.internal, &groupIds[0].id, sizeof(internal_unique_id_t));
+    uniqueId.length = sizeof(internal_unique_id_t);
+
+    return rc;
+}
+
 hccl_communicator::hccl_communicator(int rank, int comm_size) : m_rank(rank), m_commSize(comm_size) {}
 
 void hccl_communicator::incCollectiveCtr()
 {
     m_comm->incCollectiveCtr();
+
+    if (unlikely(m_scaleOutPortHealthInterval > 0) && m_comm->getCollectiveCtr() >= m_nextScaleOutPortHealthCheck)
+    {
+        recheckScaleOutPortHealth();
+    }
+}
+
+bool hccl_communicator::isScaleOutPortHealthCheckEnabled() const
+{
+    return GCFG_HCL_SCALE_OUT_PORT_HEALTH_CHECK.value() && !isLoopbackMode() && !GCFG_HCL_NULL_SUBMIT.value() &&
+           !GCFG_HCCL_OVER_OFI.value();
+}
+
+/**
+ * @brief agree with all ranks of a new communicator on the scale-out ports it should not use
+ *
+ * Every rank sends its unhealthy ports in its handshake1 header, so the agreement needs no exchange of its own and
+ * happens before the communicator opens its connections. A sick port breaks its rail for all peers, so a port
+ * unhealthy on any rank is dropped by all of them. Ports are exchanged by scale-out index, since the port numbers
+ * differ between modules. The agreement is rechecked every HCL_SCALE_OUT_PORT_HEALTH_INTERVAL collectives, see
+ * recheckScaleOutPortHealth.
+ */
+void hccl_communicator::checkScaleOutPortHealth(const std::vector<RankInfoHeader>& hcclRankInfoHeaders)
+{
+    if (!isScaleOutPortHealthCheckEnabled())
+    {
+        return;
+    }
+
+    nics_mask_t agreedPorts;
+    if (m_comm->isCommunicatorMultiScaleupGroup())
+    {
+        for (const RankInfoHeader& header : hcclRankInfoHeaders)
+        {
+            agreedPorts |= header.unhealthyScaleOutPorts;
+        }
+
+        if (hccl_device()->isScaleOutPortsRebalanceSupported())
+        {
+            m_scaleOutPortHealthInterval  = GCFG_HCL_SCALE_OUT_PORT_HEALTH_INTERVAL.value();
+            m_nextScaleOutPortHealthCheck = m_scaleOutPortHealthInterval;
+        }
+    }
+    m_agreedUnhealthyScaleOutPorts = agreedPorts;
+
+    const Gen2ArchServerConnectivity& connectivity = hccl_device()->getServerConnectivity();
+    hccl_device()->setUnhealthyScaleOutPorts(*m_comm, connectivity.getPhysicalScaleOutPorts(agreedPorts));
+}
+
+/**
+ * @brief recheck the scale-out ports health at a collective boundary, and move the communicator's scale-out
+ *        connections when the ranks agree on other unhealthy ports, e.g. a port went down or recovered
+ *
+ * All ranks number the collectives in the same order, so they all recheck before the same collective. A collective
+ * inside a group postpones the recheck to the first collective after it, on all ranks alike. The API calls on a
+ * communicator are expected to be serialized, as for the collective numbering.
+ *
+ * A recheck costs a gather and scatter through rank 0 on the bootstrap network. A change of the agreed ports also
+ * drains the communicator's streams, i.e. a pipeline bubble, and takes another round through rank 0 so no rank closes
+ * its QPs while a peer still has collectives in flight. The scale-out QPs are then reopened on the remaining ports.
+ */
+void hccl_communicator::recheckScaleOutPortHealth()
+{
+    if (hccl_device().in_group())
+    {
+        return;
+    }
+    m_nextScaleOutPortHealthCheck = m_comm->getCollectiveCtr() + m_scaleOutPortHealthInterval;
+
+    const Gen2ArchServerConnectivity& connectivity = hccl_device()->getServerConnectivity();
+
+    nics_mask_t agreedPorts = connectivity.getLogicalScaleOutPorts(hccl_device()->sampleUnhealthyScaleOutPorts());
+    if (agreeOnScaleOutPorts(agreedPorts) != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "comm({}) scale-out port health recheck failed, ports stay as they are", (HCL_Comm)*m_comm);
+        return;
+    }
+
+    if (agreedPorts == m_agreedUnhealthyScaleOutPorts)
+    {
+        return;
+    }
+
+    LOG_HCL_WARN(HCL,
+                 "comm({}) ranks agree on unhealthy scale-out ports {} instead of {} before collective#=0x{:x}, "
+                 "reconnecting scale-out",
+                 (HCL_Comm)*m_comm,
+                 agreedPorts.to_str(),
+                 m_agreedUnhealthyScaleOutPorts.to_str(),
+                 m_comm->getCollectiveCtr());
+
+    finalize();
+
+    // All ranks drained their streams once they all took part in this round
+    nics_mask_t drainedPorts = agreedPorts;
+    if (agreeOnScaleOutPorts(drainedPorts) != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "comm({}) scale-out drain agreement failed, ports stay as they are", (HCL_Comm)*m_comm);
+        return;
+    }
+
+    m_agreedUnhealthyScaleOutPorts = agreedPorts;
+    hccl_device()->reconnectScaleOut(*m_comm, connectivity.getPhysicalScaleOutPorts(agreedPorts));
+}
+
+/**
+ * @brief merge a logical scale-out ports mask of all ranks, gathered to rank 0 and sent back to every rank
+ * @param ports - this rank's ports, set to the ports of any rank on return
+ */
+hcclResult_t hccl_communicator::agreeOnScaleOutPorts(nics_mask_t& ports)
+{
+    const bool isRoot = (m_rank == 0);
+    const int  peers  = isRoot ? m_commSize : 1;  // entries exchanged with rank 0, indexed by rank on rank 0
+
+    std::vector<nics_mask_t> ranksPorts(peers, ports);
+    std::vector<nics_mask_t> agreedPorts(peers, ports);
+    std::vector<nics_mask_t> unused(peers);
+
+    hcclResult_t rc = exchangeWithRoot(std::vector<void*>(peers, &ports), entryPointers(ranksPorts), sizeof(ports));
+    if (rc != hcclSuccess) return rc;
+
+    if (isRoot)
+    {
+        nics_mask_t allPorts;
+        for (const nics_mask_t& rankPorts : ranksPorts)
+        {
+            allPorts |= rankPorts;
+        }
+        agreedPorts.assign(peers, allPorts);
+    }
+
+    rc = exchangeWithRoot(entryPointers(isRoot ? agreedPorts : unused),
+                          entryPointers(isRoot ? unused : agreedPorts),
+                          sizeof(nics_mask_t));
+    if (rc != hcclSuccess) return rc;
+
+    ports = agreedPorts[0];
+
+    return rc;
 }
 
 const uint64_t hccl_communicator::getCollectiveCtr()
@@ -486,6 +872,61 @@ hcclResult_t hccl_communicator::comm_user_rank(int* rank)
     return hcclSuccess;
 }
 
+hcclResult_t hccl_communicator::comm_topology_rank(int* rank)
+{
+    RETURN_ON_NULL_ARG(rank);
+
+    if (isLoopbackMode() || GCFG_HCL_NULL_SUBMIT.value())
+    {
+        LOG_HCL_ERR(HCL, "Topology rank order is not supported in loopback or null-submit mode");
+        return hcclInvalidUsage;
+    }
+
+    // The host NIC of every rank is only known to the rank itself
+    std::vector<int> nicNumaNodes(m_commSize, -1);
+    const ofi_t*     ofiHandle = hccl_device()->getOfiHandle();
+    nicNumaNodes[m_rank]       = ofiHandle != nullptr ? ofiHandle->getNicNumaNode() : -1;
+
+    UniqueSortedVector remoteRanks;
+    std::vector<void*> recvBuffers;
+    for (HCL_Rank remoteRank = 0; remoteRank < m_commSize; remoteRank++)
+    {
+        if (remoteRank == m_rank) continue;
+        remoteRanks.insert_sorted(remoteRank);
+        recvBuffers.push_back(&nicNumaNodes[remoteRank]);
+    }
+
+    hcclResult_t rc = exchangeWithRanks(remoteRanks, &nicNumaNodes[m_rank], recvBuffers, sizeof(int));
+    if (rc != hcclSuccess) return rc;
+
+    std::vector<RankLocation> locations(m_commSize);
+    for (HCL_Rank commRank = 0; commRank < m_commSize; commRank++)
+    {
+        const RankInfoHeader& header = m_comm->getRemoteConnectionHeader(commRank);
+        locations[commRank]          = {header.hostname, header.hwModuleID, nicNumaNodes[commRank]};
+    }
+
+    const std::vector<HCL_Rank> order = getTopologyRankOrder(locations);
+    *rank = std::find(order.begin(), order.end(), m_rank) - order.begin();
+
+    if (!isOrderBoxAligned(order, locations, m_boxSize))
+    {
+        LOG_HCL_WARN(HCL,
+                     "Hosts of comm({}) are not filled with {} ranks each, some scale-up groups will span hosts",
+                     (HCL_Comm)*m_comm,
+                     m_boxSize);
+    }
+
+    LOG_HCL_INFO(HCL,
+                 "Rank({}) topology rank({}), module({}), host NIC NUMA node({})",
+                 m_rank,
+                 *rank,
+                 locations[m_rank].hwModuleId,
+                 locations[m_rank].nicNumaNode);
+
+    return rc;
+}
+
 int hccl_communicator::user_rank() const
 {
     return m_rank;
@@ -54,6 +54,8 @@ public:
 
     hcclResult_t comm_user_rank(int* rank);
 
+    hcclResult_t comm_topology_rank(int* rank);
+
     // * * * Collectives * * *
 
     hcclResult_t allreduce(const void*     sendbuff,
@@ -65,6 +67,14 @@ public:
                            const uint32_t  flags,
                            uint8_t         apiId);
 
+    hcclResult_t allreduce_multi(const hcclAllReduceEntry_t* entries,
+                                 size_t                      numEntries,
+                                 hcclDataType_t              datatype,
+                                 hcclRedOp_t                 reduceOp,
+                                 synStreamHandle             stream_handle,
+                                 const uint32_t              flags,
+                                 uint8_t                     apiId);
+
     hcclResult_t reduce(const void*     sendbuff,
                         void*           recvbuff,
                         size_t          count,
@@ -132,6 +142,18 @@ public:
 
     spHcclCoordinatorClient getCoordClient() { return m_coordClient; };
 
+    // * * * Communicator split
+
+    struct split_rank_t
+    {
+        int rank;  // -1 for a rank without a color
+        int size;
+    };
+
+    hcclResult_t splitRanks(int color, int key, split_rank_t& splitRank, std::vector<HCL_Rank>& roots);
+    hcclResult_t
+    shareSplitUniqueId(const std::vector<HCL_Rank>& roots, hcclResult_t idResult, hcclUniqueId& uniqueId);
+
     const uint64_t getCollectiveCtr();
     void           incCollectiveCtr();
 
@@ -161,6 +183,27 @@ private:
 
     bool syncBetweenRanks();
 
+    bool         usePipelinedBroadcast(size_t count, hcclDataType_t dataType);
+    hcclResult_t pipelinedBroadcast(const void*     sendbuff,
+                                    void*           recvbuff,
+                                    size_t          count,
+                                    hcclDataType_t  dataType,
+                                    int             root,
+                                    synStreamHandle streamHandle,
+                                    uint8_t         apiId);
+
+    hcclResult_t exchangeWithRanks(UniqueSortedVector& remoteRanks,
+                                   void*               sendBuffer,
+                                   std::vector<void*>& recvBuffers,
+                                   size_t              size);
+    hcclResult_t
+    exchangeWithRoot(const std::vector<void*>& sendBuffers, const std::vector<void*>& recvBuffers, size_t size);
+
+    bool         isScaleOutPortHealthCheckEnabled() const;
+    void         checkScaleOutPortHealth(const std::vector<RankInfoHeader>& hcclRankInfoHeaders);
+    void         recheckScaleOutPortHealth();
+    hcclResult_t agreeOnScaleOutPorts(nics_mask_t& ports);
+
     HCL_Rank m_rank;
 
     void updateRemoteDevices(std::vector<RankInfoHeader>& hcclRankInfo);
@@ -172,4 +215,9 @@ private:
     bool                    m_scaleout_available;
 
     HclDynamicCommunicator* m_comm = nullptr;
+
+    // Scale-out port health rechecks, m_scaleOutPortHealthInterval is 0 when they are disabled
+    uint64_t    m_scaleOutPortHealthInterval  = 0;
+    uint64_t    m_nextScaleOutPortHealthCheck = 0;
+    nics_mask_t m_agreedUnhealthyScaleOutPorts;  // logical scale-out ports
 };
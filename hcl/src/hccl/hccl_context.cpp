@@ -13,6 +13,7 @@
 #include "hccl_context.h"
 
 #include <arpa/inet.h>               // for inet_pton
+#include <algorithm>                 // for find
 #include <netinet/in.h>              // for sockaddr_in, htons
 #include <cstring>                   // for memcpy
 #include <sys/socket.h>              // for AF_INET, sockaddr
@@ -124,6 +125,69 @@ hcclResult_t hccl_context::comm_init_rank(hcclComm_t* comm_handle, unsigned int
     return hcclSuccess;
 }
 
+hcclResult_t hccl_context::comm_split(hcclComm_t comm_handle, int color, int key, hcclComm_t* newcomm_handle)
+{
+    RETURN_ON_NULL_ARG(newcomm_handle);
+
+    hccl_communicator* parent = communicator(comm_handle);
+    if (parent == nullptr)
+    {
+        return hcclInvalidArgument;
+    }
+
+    if (isLoopbackMode() || GCFG_HCL_NULL_SUBMIT.value())
+    {
+        LOG_HCL_ERR(HCL, "Communicator split is not supported in loopback or null-submit mode");
+        return hcclInvalidUsage;
+    }
+
+    if (color < 0 && color != HCCL_SPLIT_NOCOLOR)
+    {
+        LOG_HCL_ERR(HCL, "Invalid split color({}), should be non-negative or HCCL_SPLIT_NOCOLOR", color);
+        return hcclInvalidArgument;
+    }
+
+    // rank mapping of the new communicator is derived from the parent, no need for an external bootstrap
+    hccl_communicator::split_rank_t splitRank = {};
+    std::vector<HCL_Rank>           roots;
+    hcclResult_t                    rc = parent->splitRanks(color, key, splitRank, roots);
+    RETURN_ON_ERROR(rc, "Exchange of split colors failed.");
+
+    // the first rank of the new communicator hosts its coordinator, all ranks join the ID distribution even if its
+    // creation failed so that the other members get the error
+    hcclUniqueId uniqueId = {};
+    hcclResult_t idResult = hcclSuccess;
+    if (splitRank.rank == 0)
+    {
+        idResult = get_unique_id(&uniqueId);
+        if (idResult != hcclSuccess)
+        {
+            LOG_HCL_ERR(HCL, "Failed to create split communicator unique ID.");
+        }
+    }
+    rc = parent->shareSplitUniqueId(roots, idResult, uniqueId);
+    RETURN_ON_ERROR(rc, "Distribution of split unique ID failed.");
+
+    if (color == HCCL_SPLIT_NOCOLOR)
+    {
+        LOG_HCL_INFO(HCL, "Rank({}) is not part of any split communicator", parent->user_rank());
+        *newcomm_handle = nullptr;
+        return hcclSuccess;
+    }
+
+    LOG_HCL_INFO(HCL,
+                 "Split comm({}) rank({}) color({}) key({}) into rank({}/{}), on coordinator: {}",
+                 comm_handle,
+                 parent->user_rank(),
+                 color,
+                 key,
+                 splitRank.rank,
+                 splitRank.size,
+                 unique_id_to_string(uniqueId));
+
+    return comm_init_rank(newcomm_handle, splitRank.size, uniqueId, splitRank.rank);
+}
+
 hccl_communicator* hccl_context::communicator(hcclComm_t comm_handle)
 {
     auto it = hccl_communicators_.find(comm_handle);
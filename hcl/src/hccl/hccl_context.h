@@ -43,6 +43,7 @@ public:
 
     hcclResult_t get_unique_id(hcclUniqueId* unique_id);
     hcclResult_t comm_init_rank(hcclComm_t* comm, unsigned int nranks, hcclUniqueId& comm_id, int rank);
+    hcclResult_t comm_split(hcclComm_t comm, int color, int key, hcclComm_t* newcomm);
     hcclResult_t comm_destroy(hcclComm_t unique_id);
 
     hccl_communicator* communicator(hcclComm_t comm_handle);
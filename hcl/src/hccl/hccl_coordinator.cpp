@@ -13,7 +13,9 @@
 #include "hccl_coordinator.h"
 
 #include <ext/alloc_traits.h>    // for __alloc_traits<>::value_type
+#include <algorithm>             // for min, max
 #include <poll.h>                // for pollfd, poll, POLLIN
+#include <sys/eventfd.h>         // for eventfd, EFD_NONBLOCK
 #include <sys/socket.h>          // for sockaddr, accept, getsockname
 #include <unistd.h>              // for close, read
 #include <cerrno>                // for errno
@@ -25,6 +27,7 @@
 #include "hcl_utils.h"           // for LOG_HCL_DEBUG, LOG_HCL_ERR
 #include "network_utils.h"       // for address_to_string, recv_all
 #include "hcl_log_manager.h"     // for LOG_DEBUG, LOG_ERR, LOG_TRACE
+#include "hcl_global_conf.h"     // for GCFG_HCL_STRAGGLER_FACTOR
 
 #include "../coordinator/hlcp_server.h"
 
@@ -62,7 +65,10 @@ HcclCoordinatorUPtr IHcclCoordinator::create(bool use_global_comm_ip)
 }
 
 hccl_coordinator::hccl_coordinator(sockaddr_t& ipaddr)
-: quit_requested_(false), hccl_comm_size_(HCCL_COMM_SIZE_UNASSIGNED), m_initialHandshakeDone(false)
+: quit_requested_(false),
+  hccl_comm_size_(HCCL_COMM_SIZE_UNASSIGNED),
+  m_initialHandshakeDone(false),
+  m_stragglerDetector(GCFG_HCL_STRAGGLER_FACTOR.value())
 {
     server_socket_ = createServerSocket(ipaddr);
     if (server_socket_ < 0)
@@ -74,6 +80,9 @@ hccl_coordinator::hccl_coordinator(sockaddr_t& ipaddr)
 
     LOG_HCL_DEBUG(HCL_COORD, "socket_opened: {} @ {}", server_socket_, ipaddr.str());
 
+    wakeup_fd_ = eventfd(0, EFD_NONBLOCK);
+    VERIFY(wakeup_fd_ >= 0, "Creating coordinator wakeup eventfd failed, errno: {}", errno);
+
     internal_unique_id_t internal_id_s_ = {ipaddr, sizeof(internal_id_s_.address)};
 
     hcclUniqueId unique_id;
@@ -105,6 +114,7 @@ hccl_coordinator::~hccl_coordinator()
         std::lock_guard<std::mutex> lock(srv_socket_mtx_);
         close(server_socket_);
     }
+    close(wakeup_fd_);
     {
         std::lock_guard<std::mutex> lock(comm_sockets_mtx_);
         for (auto socket : comm_sockets_)
@@ -128,14 +138,7 @@ hcclResult_t hccl_coordinator::run()
         LOG_HCL_DEBUG(HCL_COORD, "starting listen thread");
         while (!quit_requested_)
         {
-            if (comm_sockets_.size() > 0)
-            {
-                try_listen();
-            }
-            else
-            {
-                usleep(50000);  // 0.5 sec
-            }
+            try_listen();
         }
     }};
     return hcclSuccess;
@@ -199,6 +202,44 @@ void hccl_coordinator::try_accept()
             client_info_[new_socket].addr                = client_address;
         }
     });
+
+    // release the listen thread from its current poll, so the new socket is added to the next one
+    wakeup_listen();
+}
+
+void hccl_coordinator::wakeup_listen()
+{
+    const uint64_t one = 1;
+    if (write(wakeup_fd_, &one, sizeof(one)) != sizeof(one) && errno != EAGAIN)
+    {
+        LOG_HCL_WARN(HCL_COORD, "Failed to signal coordinator listen thread, errno: {}", errno);
+    }
+}
+
+/**
+ * @brief run tasks on a bounded number of threads (HCL_COORDINATOR_SEND_THREADS), instead of a thread per task
+ */
+void hccl_coordinator::parallel_run(const std::vector<std::function<void()>>& tasks)
+{
+    const size_t numThreads =
+        std::min<size_t>(tasks.size(), std::max<uint64_t>(GCFG_HCL_COORDINATOR_SEND_THREADS.value(), 1));
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (size_t t = 0; t < numThreads; t++)
+    {
+        threads.emplace_back([&tasks, t, numThreads] {
+            for (size_t i = t; i < tasks.size(); i += numThreads)
+            {
+                tasks[i]();
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
 }
 
 void hccl_coordinator::try_listen()
@@ -207,7 +248,9 @@ void hccl_coordinator::try_listen()
 
     std::lock_guard<std::mutex> lock(comm_sockets_mtx_);
 
+    // wakeup eventfd is always first, so the poll returns as soon as a new client socket is accepted
     std::vector<pollfd> sockets_to_listen;
+    sockets_to_listen.push_back({wakeup_fd_, POLLIN, 0});
     {
         for (int socket : comm_sockets_)
         {
@@ -215,13 +258,6 @@ void hccl_coordinator::try_listen()
         }
     }
 
-    if (sockets_to_listen.size() == 0)
-    {
-        LOG_HCL_TRACE(HCL_COORD, "Nothing to listen here");
-        // Nothing to listen here
-        return;
-    }
-
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
     int status = poll(sockets_to_listen.data(), sockets_to_listen.size(), 500);
 
@@ -240,6 +276,16 @@ void hccl_coordinator::try_listen()
 
     LOG_HCL_TRACE(HCL_COORD, "There is something to listen");
 
+    if (sockets_to_listen[0].revents & POLLIN)
+    {
+        uint64_t wakeups = 0;
+        if (read(wakeup_fd_, &wakeups, sizeof(wakeups)) < 0 && errno != EAGAIN)
+        {
+            LOG_HCL_WARN(HCL_COORD, "Failed to clear coordinator wakeup eventfd, errno: {}", errno);
+        }
+    }
+    sockets_to_listen.erase(sockets_to_listen.begin());
+
     for (pollfd& poll_desc : sockets_to_listen)
     {
         VERIFY(poll_desc.fd != 0, "Invalid poll_desc.fd");
@@ -333,6 +379,11 @@ void hccl_coordinator::dispatch_msg(int socket, msg_header_t& hdr, std::vector<u
             processCollectiveLog(*(reinterpret_cast<CollectiveLogMessage*>(payload.data())));
             break;
         }
+        case LATENCY_REPORT:
+        {
+            processLatencyReport(*(reinterpret_cast<LatencyReportMessage*>(payload.data())));
+            break;
+        }
         default:
         {
             VERIFY(false, "Unknown header id={}", hdr.id);
@@ -464,6 +515,7 @@ void hccl_coordinator::processNewBootstrapConn(int new_socket, hcclBsCommInfo& c
         LOG_HCL_INFO(HCL_COORD, "Coordinator received first bootstrap request");
         hccl_comm_size_ = commInfo.nRanks;
         m_collectiveLogger.setCommSize(hccl_comm_size_);
+        m_stragglerDetector.setCommSize(hccl_comm_size_);
         m_hcclRankInfoHeaders.resize(hccl_comm_size_);
         m_hcclRemoteDevices.resize(hccl_comm_size_);
         for (uint32_t rank = 0; rank < (unsigned)hccl_comm_size_; rank++)
@@ -746,6 +798,13 @@ void hccl_coordinator::processCollectiveLogMsg(const CollectiveLogMessage& msg)
     m_collectiveLogger.processLogMessage(msg);
 }
 
+void hccl_coordinator::processLatencyReport(const LatencyReportMessage& report)
+{
+    LOG_DEBUG(HCL_COORD, "Rank({}) latency report, window {}", report.rank, report.window);
+
+    m_stragglerDetector.processReport(report);
+}
+
 void hccl_coordinator::processCollectiveLogErr(const CollectiveLogMessage& msg)
 {
     LOG_HCL_CRITICAL(HCL_COORD, "rank {} reported validation failure", msg.rank);
@@ -12,23 +12,24 @@
 
 #pragma once
 
-#include <cstddef>  // for size_t
-#include <atomic>   // for atomic
-#include <cstdint>  // for uint8_t
-#include <map>      // for map
-#include <memory>   // for unique_ptr
-#include <mutex>    // for mutex
-#include <string>   // for string
-#include <thread>   // for thread
-#include <vector>   // for vector
-#include <set>      // for set
-#include <future>   // for future, async
+#include <cstddef>     // for size_t
+#include <atomic>      // for atomic
+#include <cstdint>     // for uint8_t
+#include <map>         // for map
+#include <memory>      // for unique_ptr
+#include <mutex>       // for mutex
+#include <string>      // for string
+#include <thread>      // for thread
+#include <vector>      // for vector
+#include <set>         // for set
+#include <functional>  // for function
 
 #include "hccl_types.h"             // for hcclResult_t, hcclUniqueId
 #include "deferred_launcher_job.h"  // for deferred_launcher_job
 #include "hccl_internal_defs.h"     // for msg_header_t (ptr only)
 #include "hcl_types.h"              // for RankInfo
 #include "collective_logger.h"      // for CollectiveLogger
+#include "straggler_detector.h"     // for StragglerDetector
 #include "hcl_sockaddr.h"
 
 #include "../coordinator/coordinator_defs.h"  // IHcclCoordinator
@@ -63,11 +64,16 @@ private:
     void processCollectiveLog(const CollectiveLogMessage& msg);
     void processCollectiveLogMsg(const CollectiveLogMessage& msg);
     void processCollectiveLogErr(const CollectiveLogMessage& msg);
+    void processLatencyReport(const LatencyReportMessage& report);
     bool graceful_close_bootstrap_socket(int bootstrap_socket);
+    void wakeup_listen();
+
+    static void parallel_run(const std::vector<std::function<void()>>& tasks);
 
     deferred_launcher_job        deferred_launcher_;
     std::mutex                   srv_socket_mtx_;
     int                          server_socket_;
+    int                          wakeup_fd_ = -1;  // wakes try_listen() poll when a new client socket is accepted
     std::atomic<bool>            quit_requested_;
     std::mutex                   comm_sockets_mtx_;
     std::mutex                   comm_sockets_thread_mtx_;
@@ -87,19 +93,18 @@ private:
     std::set<int>                                        sync_ranks_;
     bool m_bootstrapValidationError = false;  // did any of the ranks fail, for any reason, during bootstrap
 
-    CollectiveLogger m_collectiveLogger;
+    CollectiveLogger  m_collectiveLogger;
+    StragglerDetector m_stragglerDetector;
 };
 
+// run LAMBDA for every LOOP iteration, spread over at most HCL_COORDINATOR_SEND_THREADS threads
 #define parallel_for_void(LOOP, LAMBDA)                                                                                \
     {                                                                                                                  \
-        std::vector<std::future<void>> futures;                                                                        \
+        std::vector<std::function<void()>> tasks;                                                                      \
         for (LOOP)                                                                                                     \
         {                                                                                                              \
-            futures.push_back(std::async(std::launch::async, LAMBDA));                                                 \
+            tasks.push_back(LAMBDA);                                                                                   \
         }                                                                                                              \
                                                                                                                        \
-        for (std::future<void> & f : futures)                                                                          \
-        {                                                                                                              \
-            f.get();                                                                                                   \
-        }                                                                                                              \
+        parallel_run(tasks);                                                                                           \
     }
@@ -18,12 +18,13 @@
 #include <string>     // for string
 #include <chrono>     // for system_clock
 
-#include "hccl_helpers.h"     // for RETURN_ON_ERROR, RETURN_ON_COND
-#include "hcl_tcp_utils.h"    // for sendAllToSocket, recvAllFrom...
-#include "hcl_utils.h"        // for VERIFY, LOG_HCL_ERR
-#include "network_utils.h"    // for address_to_string
-#include "hcl_log_manager.h"  // for LOG_ERR, LOG_DEBUG
-#include "hcl_types.h"        // for RankInfo
+#include "hccl_helpers.h"             // for RETURN_ON_ERROR, RETURN_ON_COND
+#include "hcl_tcp_utils.h"            // for sendAllToSocket, recvAllFrom...
+#include "hcl_utils.h"                // for VERIFY, LOG_HCL_ERR
+#include "network_utils.h"            // for address_to_string
+#include "hcl_log_manager.h"          // for LOG_ERR, LOG_DEBUG
+#include "hcl_types.h"                // for RankInfo
+#include "infra/hcl_latency_stats.h"  // for LatencyReportMessage
 
 HcclCoordinatorClient::HcclCoordinatorClient(int nranks, HCL_Rank rank, const internal_unique_id_t* internalUniqueId)
 : m_rank(rank), m_nranks(nranks)
@@ -421,6 +422,7 @@ hcclResult_t HcclCoordinatorClient::sendCollectiveLogMsg(CollectiveLogMessage& m
     msg_header_t hdr {COLLECTIVE_LOG, 0, sizeof(CollectiveLogMessage), 0, 0};
     msg.timestamp = ms.count();
 
+    std::lock_guard<std::mutex> lock(m_logSocketMutex);
     // send header
     RETURN_ON_ERROR(sendToCoordinator(m_logSocket, &hdr, sizeof(hdr)), "Send hdr to coordinator failed.");
     // send body
@@ -429,3 +431,23 @@ hcclResult_t HcclCoordinatorClient::sendCollectiveLogMsg(CollectiveLogMessage& m
 
     return hcclSuccess;
 }
+
+hcclResult_t HcclCoordinatorClient::sendLatencyReport(const LatencyReportMessage& report)
+{
+    // failed to set non-blocking mode on log socket
+    if (m_logSocket == -1)
+    {
+        return hcclSocketError;
+    }
+
+    msg_header_t hdr {LATENCY_REPORT, 0, sizeof(LatencyReportMessage), 0, 0};
+
+    std::lock_guard<std::mutex> lock(m_logSocketMutex);
+    // send header
+    RETURN_ON_ERROR(sendToCoordinator(m_logSocket, &hdr, sizeof(hdr)), "Send hdr to coordinator failed.");
+    // send body
+    RETURN_ON_ERROR(sendToCoordinator(m_logSocket, (void*)&report, sizeof(LatencyReportMessage)),
+                    "Send latency report to coordinator failed.");
+
+    return hcclSuccess;
+}
@@ -15,6 +15,7 @@
 #include <cstddef>               // for size_t
 #include <cstdint>               // for uint32_t
 #include <memory>                // for shared_ptr
+#include <mutex>                 // for mutex
 #include <vector>                // for vector
 #include "hccl_internal_defs.h"  // for hccl_rank_discovery_data_t (ptr only)
 #include "hccl_types.h"          // for hcclResult_t
@@ -48,6 +49,7 @@ public:
                                            const HCL_Rank         peer,
                                            const HCL_Rank         root) override;
     virtual hcclResult_t sendCollectiveLogErr() override;
+    virtual hcclResult_t sendLatencyReport(const LatencyReportMessage& report) override;
 
     virtual hcclResult_t sendRecvFromRanks(UniqueSortedVector& nonPeerRemoteRanks,
                                            std::vector<void*>& recvBuffers,
@@ -81,6 +83,7 @@ private:
     int                  m_mainSocket      = -1;
     int                  m_asyncRecvSocket = -1;
     int                  m_logSocket       = -1;  // collective logs non-blocking socket
+    std::mutex           m_logSocketMutex;        // logs and latency reports are sent from different threads
     SocketThreadsManager m_threadManager;
 
     std::vector<uint32_t> m_sendSequence;
@@ -60,6 +60,16 @@ hcclResult_t hcclCommInitRank_impl(hcclComm_t* comm, int nranks, hcclUniqueId co
  * Order of devlist defines user-order of processors within the communicator. */
 hcclResult_t hcclCommInitAll_impl(hcclComm_t* comm, int ndev, const int* devlist);
 
+/* Creates new communicators out of the ranks of an existing communicator.
+ * Must be called by all ranks of comm. Ranks passing the same color are grouped
+ * into the same new communicator, ordered by key (ties are broken by the rank in comm).
+ * Ranks passing HCCL_SPLIT_NOCOLOR do not join any communicator and get a NULL newcomm. */
+hcclResult_t hcclCommSplit_impl(hcclComm_t comm, int color, int key, hcclComm_t* newcomm);
+
+/* Creates a new communicator with the same ranks as comm.
+ * Must be called by all ranks of comm. */
+hcclResult_t hcclCommDup_impl(hcclComm_t comm, hcclComm_t* newcomm);
+
 /* Waits for all submitted work of communicator to be done.
  * By doing so, prepares communicator for destruction. */
 hcclResult_t hcclCommFinalize_impl(hcclComm_t comm);
@@ -87,6 +97,13 @@ hcclResult_t hcclCommSynDevice_impl(hcclComm_t comm, int* device);
 /* Returns the user-ordered "rank" associated with the communicator. */
 hcclResult_t hcclCommUserRank_impl(hcclComm_t comm, int* rank);
 
+/* Returns the rank of the caller in the topology-aware order of comm's ranks.
+ * In that order the ranks of a box are contiguous and ordered by their host NIC NUMA node and module,
+ * so scale-up groups match the boxes and scale-out peers line up on the same ports.
+ * Must be called by all ranks of comm. Passing the result as key to hcclCommSplit
+ * creates a communicator that uses this order. */
+hcclResult_t hcclCommTopologyRank_impl(hcclComm_t comm, int* rank);
+
 /* Returns FD for HBM memory region if it was registered for gaudi-direct. */
 int hcclLookupDMABuff_impl(uint64_t addr, uint64_t size, int* fd);
 
@@ -172,6 +189,19 @@ hcclResult_t hcclAllReduce_impl(const void*     sendbuff,
                                 hcclComm_t      comm,
                                 synStreamHandle stream_handle);
 
+/*
+ * Fused All-Reduce
+ *
+ * Performs an All-Reduce over each of the numEntries (sendbuff, recvbuff, count)
+ * entries, sharing datatype and reduceOp, as a single submission.
+ */
+hcclResult_t hcclAllReduceMulti_impl(const hcclAllReduceEntry_t* entries,
+                                     size_t                      numEntries,
+                                     hcclDataType_t              datatype,
+                                     hcclRedOp_t                 reduceOp,
+                                     hcclComm_t                  comm,
+                                     synStreamHandle             stream_handle);
+
 /*
  * Reduce-Scatter
  *
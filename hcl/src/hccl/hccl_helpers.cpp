@@ -203,6 +203,10 @@ std::string to_string(hcclDataType_t data_type)
             return "fp64";
         case hcclBfloat16:
             return "bf16";
+        case hcclFp8E4M3:
+            return "fp8_e4m3";
+        case hcclFp8E5M2:
+            return "fp8_e5m2";
         default:
             return "<invalid-data-type:" + std::to_string(static_cast<int>(data_type)) + ">";
     }
@@ -236,6 +240,10 @@ size_t hccl_data_type_elem_size(hcclDataType_t data_type)
         case hcclBfloat16:
             // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
             return 2;
+        case hcclFp8E4M3:
+        case hcclFp8E5M2:
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+            return 1;
         case hcclNumTypes:
             break;
     }
@@ -263,6 +271,9 @@ hcclDataType_t from_hccl_data_type_for_emulation(hcclDataType_t data_type)
             return hcclInt32;
         case hcclBfloat16:
             return hcclBfloat16;
+        case hcclFp8E4M3:
+        case hcclFp8E5M2:
+            return hcclBfloat16;
         case hcclNumTypes:
             break;
     }
@@ -45,6 +45,13 @@
                           _arg,                                                                                        \
                           "Invalid or unsupported data type");
 
+// FP8 is only moved as-is - there is no FP8 reduction datatype in the NIC/EDMA reduction engines
+#define RETURN_ON_INVALID_DATA_MOVEMENT_TYPE(_arg)                                                                     \
+    RETURN_ON_INVALID_ARG(_arg != hcclFloat32 && _arg != hcclBfloat16 && _arg != hcclFloat16 && _arg != hcclFp8E4M3 && \
+                              _arg != hcclFp8E5M2,                                                                     \
+                          _arg,                                                                                        \
+                          "Invalid or unsupported data type");
+
 #define RETURN_ON_INVALID_ADDR(addr)                                                                                   \
     {                                                                                                                  \
         bool valid = hccl_device()->isDramAddressValid((uint64_t)addr);                                                \
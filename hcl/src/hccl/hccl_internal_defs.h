@@ -22,6 +22,8 @@
 
 class ofi_req_t;
 struct ofiComm_t;
+class HclCongestionWindow;
+class EagerRecvRing;
 
 #define CORD_ID_GLOBAL_COMM 1
 constexpr int HOST_BUFF_INC = 64 * 1024 * 1024;  // 64MB
@@ -41,6 +43,7 @@ typedef enum
     DATA_BETWEEN_RANKS,
     BOOTSTRAP_COMM_DESTROY,
     COLLECTIVE_LOG,  // log over bootstrap network
+    LATENCY_REPORT,  // collective latency report over bootstrap network
 } bootstrap_hdr_id_t;
 
 struct msg_header_t
@@ -194,10 +197,15 @@ struct hcclInternalHandle
 
 struct hcclOfiHandle
 {
-    ofi_req_t* req {nullptr};
-    ofiComm_t* ofiComm {nullptr};
-    void*      recvBuffer {nullptr};
-    int        size {0};
+    ofi_req_t*           req {nullptr};
+    ofiComm_t*           ofiComm {nullptr};
+    void*                recvBuffer {nullptr};
+    int                  size {0};
+    uint8_t*             eagerSlot {nullptr};   // eager send staging slot, released once the send completes
+    EagerRecvRing*       eagerRing {nullptr};   // ring an eager recv completes through, instead of req
+    uint64_t             eagerSeq {0};          // message number of an eager recv in its ring
+    HclCongestionWindow* sendWindow {nullptr};  // window the send is accounted in, released once the send completes
+    uint64_t             postTimeNsec {0};
 };
 
 struct hcclHandle
@@ -49,6 +49,11 @@ hcclResult_t hccl_communicator::hccl_receive(void*           recvbuff,
                             m_comm->m_remoteDevices[peer]->header.hwModuleID,
                             m_comm->isRankInsideScaleupGroup(peer)};
 
+    if (m_comm->m_metrics)
+    {
+        m_comm->m_metrics->onRecv(count * dataTypeSizeInBytes(dataType));
+    }
+
     return hccl_device().send_recv_call(m_comm->getMyRank(), entry);
 }
 
@@ -70,5 +75,10 @@ hcclResult_t hccl_communicator::hccl_send(const void*     sendbuff,
                             m_comm->m_remoteDevices[peer]->header.hwModuleID,
                             m_comm->isRankInsideScaleupGroup(peer)};
 
+    if (m_comm->m_metrics)
+    {
+        m_comm->m_metrics->onSend(count * dataTypeSizeInBytes(dataType));
+    }
+
     return hccl_device().send_recv_call(m_comm->getMyRank(), entry);
 }
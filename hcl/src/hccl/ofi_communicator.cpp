@@ -17,6 +17,11 @@
 
 ofi_communicator::ofi_communicator() : my_rank_(-1) {}
 
+ofi_communicator::~ofi_communicator()
+{
+    destroyEager();
+}
+
 bool ofi_communicator::initializeCommunicator(int                       hcclRank,
                                               int                       nranks,
                                               const UniqueSortedVector& peers,
@@ -36,6 +41,10 @@ bool ofi_communicator::initializeCommunicator(int                       hcclRank
     {
         m_peerRankToConnectionInfo.resize(nranks);
     }
+    if (m_eagerConnections.empty())
+    {
+        m_eagerConnections.resize(nranks);
+    }
 
     m_ofi_        = hclDevice->getOfiHandle();
     m_ofiDeviceId = hclDevice->getOfiDeviceId();
@@ -43,6 +52,9 @@ bool ofi_communicator::initializeCommunicator(int                       hcclRank
     m_qpSetCount  = qpSetCount;
     my_rank_      = hcclRank;
 
+    initSendWindows();
+    initEager();
+
     for (const HCL_Rank peer : peers)
     {
         for (uint16_t qpSetIndex = 0; qpSetIndex < m_qpSetCount; ++qpSetIndex)
@@ -132,6 +144,11 @@ bool ofi_communicator::updateConnections(const HCL_Rank outerRank, const HostNic
                     return false;
                 }
             }
+
+            if (!initEagerConnection(outerRank, qpSetIndex, hostConnIdx))
+            {
+                return false;
+            }
         }
     }
 
@@ -150,25 +167,57 @@ hcclResult_t ofi_communicator::sendAsync(void*                  sendbuff,
 
     if (!m_ofi_->is_initialized())
     {
+        releaseSendCredit(qpSetIndex);
         LOG_HCL_ERR(HCL, "ofi must be initialized before any send");
         return hcclLibfabricError;
     }
 
-    int status = post_send(m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx].sendComm,
-                           sendbuff,
+    // Eager messages go to the receiver's preposted slots. When it owns a private copy of the payload, the device is
+    // signaled here and the provider completion only releases the staging slot.
+    const bool            eager       = size > 0 && size <= m_eagerSize;
+    uint8_t*              eagerSlot   = eager ? acquireEagerSlot() : nullptr;
+    OfiCompCallbackParams eagerParams = compParams;
+    if (eagerSlot != nullptr)
+    {
+        std::memcpy(eagerSlot, sendbuff, size);
+        eagerParams.compCallBack = nullptr;
+    }
+
+    int status = post_send(eager ? m_eagerConnections[peer][qpSetIndex][hostConnIdx].sendComm.get()
+                                 : m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx].sendComm,
+                           eagerSlot != nullptr ? eagerSlot : sendbuff,
                            size,
                            &handle->ofi.req,
                            m_ofi_,
-                           compParams);
+                           eagerParams,
+                           eagerSlot != nullptr ? m_eagerMr : nullptr);
     if (status)
     {
+        releaseEagerSlot(eagerSlot);
+        releaseSendCredit(qpSetIndex);
         LOG_HCL_ERR(HCL, "send from {} to {} failed", my_rank_, peer);
         return hcclLibfabricError;
     }
 
+    if (eagerSlot != nullptr && compParams.compCallBack)
+    {
+        compParams.compCallBack(&compParams);
+    }
+
     handle->isOfiReq       = true;
     handle->ofi.recvBuffer = nullptr;
     handle->ofi.size       = size;
+    handle->ofi.eagerSlot  = eagerSlot;
+    handle->ofi.eagerRing  = nullptr;
+    if (m_sendWindowsEnabled)
+    {
+        handle->ofi.sendWindow   = &m_sendWindows[qpSetIndex];
+        handle->ofi.postTimeNsec = HclCongestionWindow::nowNsec();
+    }
+    else
+    {
+        handle->ofi.sendWindow = nullptr;
+    }
 
     return hcclSuccess;
 }
@@ -189,6 +238,27 @@ hcclResult_t ofi_communicator::recvAsync(void*                  recvbuff,
         return hcclLibfabricError;
     }
 
+    if (size > 0 && size <= m_eagerSize)
+    {
+        EagerRecvRing* ring = m_eagerConnections[peer][qpSetIndex][hostConnIdx].recvRing.get();
+        if (!ring->post(recvbuff, size, compParams, handle->ofi.eagerSeq))
+        {
+            LOG_HCL_ERR(HCL, "eager receive from {} to {} failed", peer, my_rank_);
+            return hcclLibfabricError;
+        }
+
+        handle->isOfiReq       = true;
+        handle->ofi.req        = nullptr;
+        handle->ofi.ofiComm    = nullptr;
+        handle->ofi.recvBuffer = recvbuff;
+        handle->ofi.size       = size;
+        handle->ofi.eagerSlot  = nullptr;
+        handle->ofi.eagerRing  = ring;
+        handle->ofi.sendWindow = nullptr;
+
+        return hcclSuccess;
+    }
+
     int status = post_recv(m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx].recvComm,
                            recvbuff,
                            size,
@@ -205,6 +275,9 @@ hcclResult_t ofi_communicator::recvAsync(void*                  recvbuff,
     handle->ofi.ofiComm    = m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx].recvComm;
     handle->ofi.recvBuffer = recvbuff;
     handle->ofi.size       = size;
+    handle->ofi.eagerSlot  = nullptr;
+    handle->ofi.eagerRing  = nullptr;
+    handle->ofi.sendWindow = nullptr;
 
     return hcclSuccess;
 }
@@ -214,6 +287,16 @@ bool ofi_communicator::waitForCompletionNb(void* handle, int& done)
     hcclOfiHandle* ofiHandle = (hcclOfiHandle*)handle;
     ofi_req_t*     request   = ofiHandle->req;
 
+    if (ofiHandle->eagerRing != nullptr)
+    {
+        if (!ofiHandle->eagerRing->test(ofiHandle->eagerSeq, done))
+        {
+            LOG_HCL_ERR(HCL, "eager recv test failed");
+            return false;
+        }
+        return true;
+    }
+
     int    status;
     size_t ssize = 0;
 
@@ -221,6 +304,30 @@ bool ofi_communicator::waitForCompletionNb(void* handle, int& done)
     if (status)
     {
         done = 1;
+    }
+
+    if (done && ofiHandle->eagerSlot != nullptr)
+    {
+        releaseEagerSlot(ofiHandle->eagerSlot);
+        ofiHandle->eagerSlot = nullptr;
+    }
+
+    if (done && ofiHandle->sendWindow != nullptr)
+    {
+        if (status)
+        {
+            ofiHandle->sendWindow->release();
+        }
+        else
+        {
+            ofiHandle->sendWindow->onCompletion(HclCongestionWindow::nowNsec() - ofiHandle->postTimeNsec,
+                                                ofiHandle->size);
+        }
+        ofiHandle->sendWindow = nullptr;
+    }
+
+    if (status)
+    {
         LOG_HCL_ERR(HCL, "test failed");
         return false;
     }
@@ -254,6 +361,8 @@ bool ofi_communicator::destroy()
     }
     threads_manager_.destroy();
 
+    destroyEager();
+
     return true;
 }
 
@@ -261,3 +370,168 @@ unsigned ofi_communicator::getNumConnectionPerRank()
 {
     return (GCFG_ENABLE_HNIC_MICRO_STREAMS.value() ? MAX_HNIC_CONNECTIONS : 1);
 }
+
+bool ofi_communicator::acquireSendCredit(uint16_t qpSetIndex)
+{
+    return !m_sendWindowsEnabled || m_sendWindows[qpSetIndex].tryAcquire();
+}
+
+void ofi_communicator::releaseSendCredit(uint16_t qpSetIndex)
+{
+    if (m_sendWindowsEnabled)
+    {
+        m_sendWindows[qpSetIndex].release();
+    }
+}
+
+void ofi_communicator::initSendWindows()
+{
+    if (m_sendWindowsEnabled || !GCFG_HCL_HNIC_ADAPTIVE_CONGESTION_WINDOW.value())
+    {
+        return;
+    }
+
+    // The static QP congestion window is the starting point, 0 means the device has none
+    const uint32_t maxWindow     = GCFG_HCL_HNIC_CONGESTION_WINDOW_MAX.value();
+    const int64_t  staticWindow  = GCFG_CONGESTION_WINDOW.value();
+    const uint32_t initialWindow = staticWindow > 0 ? staticWindow : maxWindow;
+    for (HclCongestionWindow& window : m_sendWindows)
+    {
+        window.init(initialWindow,
+                    maxWindow,
+                    GCFG_HCL_HNIC_CONGESTION_TARGET_DELAY_PERCENT.value(),
+                    GCFG_HCL_HNIC_CONGESTION_MAX_STALL_USEC.value());
+    }
+    m_sendWindowsEnabled = true;
+
+    LOG_HCL_INFO(HCL,
+                 "Adaptive congestion window enabled for {} QP sets, initial window {}, max window {}",
+                 m_qpSetCount,
+                 initialWindow,
+                 maxWindow);
+}
+
+void ofi_communicator::initEager()
+{
+    // Gaudi-direct sends straight from device memory, which cannot be staged on the host
+    if (m_eagerSize != 0 || ofi_t::isGaudiDirect())
+    {
+        return;
+    }
+
+    const uint64_t eagerSize = GCFG_HCL_HNIC_EAGER_MAX_SIZE.value();
+    const uint64_t recvSlots = GCFG_HCL_HNIC_EAGER_RECV_SLOTS.value();
+    const uint64_t tagBit    = m_ofi_->getOfiComponent(m_ofiDeviceId)->get_eager_tag_bit();
+    if (eagerSize == 0 || recvSlots == 0 || tagBit == 0)
+    {
+        return;
+    }
+
+    m_eagerSize      = eagerSize;
+    m_eagerTagBit    = tagBit;
+    m_eagerRecvSlots = recvSlots;
+
+    const uint64_t slotCount = GCFG_HCL_HNIC_EAGER_SEND_SLOTS.value();
+    if (slotCount == 0)
+    {
+        LOG_HCL_DEBUG(HCL, "Rank {} eager messages up to {} bytes, no send staging slots", my_rank_, eagerSize);
+        return;
+    }
+
+    m_eagerBuffer.resize(eagerSize * slotCount);
+    m_eagerFreeSlots.reserve(slotCount);
+    for (uint64_t slot = 0; slot < slotCount; ++slot)
+    {
+        m_eagerFreeSlots.push_back(m_eagerBuffer.data() + slot * eagerSize);
+    }
+
+    // Register the whole ring once, eager sends pass its descriptor and never go through the MR lookup
+    if (ofi_t::isMRLocal())
+    {
+        if (m_ofi_->getOfiComponent(m_ofiDeviceId)
+                ->register_mr(m_eagerBuffer.data(), m_eagerBuffer.size(), FI_HMEM_SYSTEM, 0, &m_eagerMr) != 0)
+        {
+            LOG_HCL_WARN(HCL, "Failed to register eager send slots, eager sends are not staged");
+            m_eagerMr = nullptr;
+            m_eagerFreeSlots.clear();
+            m_eagerBuffer.clear();
+            return;
+        }
+    }
+
+    LOG_HCL_DEBUG(HCL,
+                  "Rank {} eager messages up to {} bytes, send slots={}, recv slots per connection={}",
+                  my_rank_,
+                  eagerSize,
+                  slotCount,
+                  recvSlots);
+}
+
+bool ofi_communicator::initEagerConnection(const HCL_Rank peer, const uint16_t qpSetIndex, const unsigned hostConnIdx)
+{
+    if (m_eagerSize == 0)
+    {
+        return true;
+    }
+
+    const allConnectionComm_t& conn  = m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx];
+    EagerConnection&           eager = m_eagerConnections[peer][qpSetIndex][hostConnIdx];
+
+    // The eager channel is the connection on its tag with the eager bit set, it shares the connection's endpoints
+    eager.sendComm                     = std::make_unique<ofiComm_t>(*conn.sendComm);
+    eager.sendComm->tag                = conn.sendComm->tag | m_eagerTagBit;
+    eager.sendComm->num_inflight_sends = 0;
+    eager.sendComm->num_inflight_recvs = 0;
+
+    ofiComm_t recvComm = *conn.recvComm;
+    recvComm.tag       = conn.recvComm->tag | m_eagerTagBit;
+    eager.recvRing     = std::make_unique<EagerRecvRing>(m_ofi_, recvComm);
+    if (!eager.recvRing->init(m_eagerSize, m_eagerRecvSlots))
+    {
+        LOG_HCL_ERR(HCL, "Failed to prepost eager recv slots for rank {} from rank {}", my_rank_, peer);
+        return false;
+    }
+
+    return true;
+}
+
+void ofi_communicator::destroyEager()
+{
+    m_eagerConnections.clear();
+
+    if (m_eagerMr != nullptr)
+    {
+        if (ofi_component_t::deregister_mr(m_eagerMr) != 0)
+        {
+            LOG_HCL_ERR(HCL, "Failed to deregister eager send slots MR");
+        }
+        m_eagerMr = nullptr;
+    }
+    m_eagerSize = 0;
+    m_eagerFreeSlots.clear();
+    m_eagerBuffer.clear();
+}
+
+uint8_t* ofi_communicator::acquireEagerSlot()
+{
+    std::lock_guard<std::mutex> lock(m_eagerMutex);
+    if (m_eagerFreeSlots.empty())
+    {
+        return nullptr;
+    }
+
+    uint8_t* slot = m_eagerFreeSlots.back();
+    m_eagerFreeSlots.pop_back();
+    return slot;
+}
+
+void ofi_communicator::releaseEagerSlot(uint8_t* slot)
+{
+    if (slot == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_eagerMutex);
+    m_eagerFreeSlots.push_back(slot);
+}
@@ -1,15 +1,19 @@
 #pragma once
 
+#include <array>                         // for array
 #include <chrono>                        // for seconds, microseconds
 #include <cstddef>                       // for size_t
 #include <map>                           // for map
 #include <memory>                        // for unique_ptr
+#include <mutex>                         // for mutex
 #include <vector>                        // for vector
 #include "hccl_types.h"                  // for hcclResult_t
 #include "interfaces/hcl_idevice.h"      // for IHclDevice
 #include "libfabric/hl_ofi_component.h"  // for allConnectionComm_t, ofi_req_t (p...
 #include "socket_thread.h"               // for SocketThreadsManager
 #include "hcl_utils.h"                   // for VERIFY
+#include "infra/hcl_congestion_window.h"  // for HclCongestionWindow
+#include "libfabric/ofi_eager_recv_ring.h"  // for EagerRecvRing
 
 class UniqueSortedVector;
 class ofi_t;
@@ -48,9 +52,14 @@ public:
                            uint16_t               qpSetIndex);
     bool         waitForCompletionNb(void* handle, int& done);
 
+    // Reserve room for a send on the QP set's congestion window, always granted when the adaptive window is disabled.
+    // The reservation is handed over to the send by sendAsync, or returned with releaseSendCredit if it is not posted.
+    bool acquireSendCredit(uint16_t qpSetIndex);
+    void releaseSendCredit(uint16_t qpSetIndex);
+
     bool destroy();
 
-    ~ofi_communicator() = default;
+    ~ofi_communicator();
     ofi_communicator();
 
     ofi_communicator(ofi_communicator&)              = delete;
@@ -78,5 +87,38 @@ private:
 
     unsigned getNumConnectionPerRank();
 
+    void     initSendWindows();
+    void     initEager();
+    bool     initEagerConnection(HCL_Rank peer, uint16_t qpSetIndex, unsigned hostConnIdx);
+    void     destroyEager();
+    uint8_t* acquireEagerSlot();
+    void     releaseEagerSlot(uint8_t* slot);
+
     RankInfo* m_myRankInfo = nullptr;
+
+    // Messages up to m_eagerSize go over the eager channel of their connection, a second tag of it on which the
+    // receiver keeps slots preposted (see EagerRecvRing). Both sides enable it from the same GCFGs, 0 when disabled.
+    struct EagerConnection
+    {
+        std::unique_ptr<ofiComm_t>     sendComm;
+        std::unique_ptr<EagerRecvRing> recvRing;
+    };
+    using EagerQpSet = std::array<EagerConnection, MAX_HNIC_CONNECTIONS>;
+    std::vector<std::array<EagerQpSet, MAX_HNIC_CONNECTION_SETS>> m_eagerConnections;
+    size_t                                                        m_eagerSize      = 0;
+    uint64_t                                                      m_eagerTagBit    = 0;
+    unsigned                                                      m_eagerRecvSlots = 0;
+
+    // Eager sends are copied into a host staging slot when one is free, so the device can be signaled as soon as the
+    // send is posted instead of after the provider reports delivery. A slot is released when the wait-for-completion
+    // stream reaps the send. The slots have their own MR, owned by the communicator and never shared with the MR
+    // mapping.
+    std::vector<uint8_t>  m_eagerBuffer;
+    struct fid_mr*        m_eagerMr = nullptr;
+    std::vector<uint8_t*> m_eagerFreeSlots;
+    std::mutex            m_eagerMutex;
+
+    // Sends in flight are limited per QP set by a window that follows the measured completion latency
+    bool                                                      m_sendWindowsEnabled = false;
+    std::array<HclCongestionWindow, MAX_HNIC_CONNECTION_SETS> m_sendWindows;
 };
@@ -48,13 +48,16 @@ void SocketThread::runThread()
  * @brief Look for a job in m_Asyncjobs that matches a hdr of a PendingJob.
  * In case such is found, place the PendingJob's data in the correct buffer, and release the job's handle.
  *
+ * @return true if any job was released
  */
-void SocketThread::runPendingJobs()
+bool SocketThread::runPendingJobs()
 {
+    bool released = false;
     LOG_HCL_TRACE(HCL, "m_PendingJobs.size={}", m_PendingJobs.size());
     for (std::vector<PendingJob>::iterator itr = m_PendingJobs.begin(); itr != m_PendingJobs.end();)
     {
-        if (!m_Asyncjobs[itr->hdr.source_peer].empty())
+        SocketJob job;
+        if (popAsyncJob(itr->hdr.source_peer, job))
         {
             LOG_HCL_DEBUG(HCL,
                           "Rank({}) AsyncThread({}) found a match for a pending job with peer={}, seq={}",
@@ -62,7 +65,6 @@ void SocketThread::runPendingJobs()
                           m_socketThreadId,
                           itr->hdr.source_peer,
                           itr->hdr.sequence);
-            SocketJob job = m_Asyncjobs[itr->hdr.source_peer].front();
 
             if (job.m_size != itr->hdr.payload_size || job.m_sequence != itr->hdr.sequence)
             {
@@ -79,20 +81,50 @@ void SocketThread::runPendingJobs()
                     job.m_size);
                 job.m_handle->result = false;
                 job.m_handle->setHandleAsDone();
-                return;
+                return true;
             }
 
             memcpy(job.m_address, itr->jobAddr, job.m_size);
             job.m_handle->setHandleAsDone();
-            m_Asyncjobs[itr->hdr.source_peer].pop();
             free(itr->jobAddr);
-            itr = m_PendingJobs.erase(itr);
+            itr      = m_PendingJobs.erase(itr);
+            released = true;
         }
         else
         {
             itr++;
         }
     }
+
+    return released;
+}
+
+bool SocketThread::anyAsyncJob() const
+{
+    for (auto const& entry : m_Asyncjobs)
+    {
+        if (!entry.second.empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Pop the next expected job of a peer, if any was pushed by the main thread.
+ */
+bool SocketThread::popAsyncJob(HCL_Rank peer, SocketJob& job)
+{
+    std::lock_guard<std::mutex> lock(m_asyncJobsMutex);
+    auto                        it = m_Asyncjobs.find(peer);
+    if (it == m_Asyncjobs.end() || it->second.empty())
+    {
+        return false;
+    }
+    job = it->second.front();
+    it->second.pop();
+    return true;
 }
 
 void SocketThread::runAsyncThread()
@@ -104,32 +136,27 @@ void SocketThread::runAsyncThread()
     while (!m_stop)
     {
         pushedToPendingJobs = false;
-        // try to release a pending job before receiving new data from socket
-        if (!m_PendingJobs.empty())
-        {
-            runPendingJobs();
-        }
 
         /*
         Check if any job is in queue. If yes => wait for to recv hdr & data payload on socket - it could be:
         1. A job we are waiting for in m_Asyncjobs - in this case we will process it
         2. A job we are not currently expecting - in this case we will push it to pending.
-        In case the jobs queue is empty - we do not block on receive but simply wait for main thread to put jobs.
-        If we receive something in the socket at this stage it is kept in the OS socket buffers and will be processed
-        once any job is put into queue.
+        In case the jobs queue is empty - we do not block on receive but wait for main thread to put jobs (woken by
+        pushAsyncJob). If we receive something in the socket at this stage it is kept in the OS socket buffers and will
+        be processed once any job is put into queue.
         */
-        bool anyJob = false;
-        for (auto const& entry : m_Asyncjobs)
         {
-            if (!entry.second.empty())
-            {
-                anyJob = true;
-                break;
-            }
+            std::unique_lock<std::mutex> lock(m_asyncJobsMutex);
+            m_asyncJobsCv.wait(lock, [this] { return m_stop || anyAsyncJob(); });
         }
-        if (!anyJob)
+        if (m_stop)
+        {
+            break;
+        }
+
+        // the new job may have already been received, release it before blocking on the socket for new data
+        if (!m_PendingJobs.empty() && runPendingJobs())
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(2));  // delay 2msec
             continue;
         }
 
@@ -181,9 +208,8 @@ void SocketThread::runAsyncThread()
         while (!pushedToPendingJobs)
         {
             loopsCounter++;
-            if (!m_Asyncjobs[hdr.source_peer].empty())
+            if (popAsyncJob(hdr.source_peer, pJob))
             {
-                pJob = m_Asyncjobs[hdr.source_peer].front();
                 break;
             }
 
@@ -199,38 +225,37 @@ void SocketThread::runAsyncThread()
             }
 
             // If some peer has an async job in queue, push the current job to the pendingJobs queue to avoid deadlock
-            for (auto const& entry : m_Asyncjobs)
+            bool anyJob = false;
             {
-                if (!entry.second.empty())
+                std::lock_guard<std::mutex> lock(m_asyncJobsMutex);
+                anyJob = anyAsyncJob();
+            }
+            if (anyJob)
+            {
+                PendingJob pendingJob;
+                memcpy(&(pendingJob.hdr), &hdr, sizeof(hdr));
+                pendingJob.jobAddr = malloc(hdr.payload_size);
+                LOG_HCL_TRACE(HCL,
+                              "Rank({}) about to receive payload from socket and push a job to the pending queue "
+                              "from source_peer={}, loopsCounter={}",
+                              m_globalRank,
+                              pendingJob.hdr.source_peer,
+                              loopsCounter);
+                if (!recvAllFromSocket(m_socket, pendingJob.jobAddr, hdr.payload_size))
                 {
-                    PendingJob pendingJob;
-                    memcpy(&(pendingJob.hdr), &hdr, sizeof(hdr));
-                    pendingJob.jobAddr = malloc(hdr.payload_size);
-                    LOG_HCL_TRACE(HCL,
-                                  "Rank({}) about to receive payload from socket and push a job to the pending queue "
-                                  "from source_peer={}, loopsCounter={}",
-                                  m_globalRank,
-                                  pendingJob.hdr.source_peer,
-                                  loopsCounter);
-                    if (!recvAllFromSocket(m_socket, pendingJob.jobAddr, hdr.payload_size))
-                    {
-                        LOG_HCL_ERR(HCL,
-                                    "Rank({}) AsyncThread({}) failed to receive data",
-                                    m_globalRank,
-                                    m_socketThreadId);
-                        free(pendingJob.jobAddr);
-                        return;
-                    }
-                    m_PendingJobs.push_back(pendingJob);
-                    LOG_HCL_TRACE(HCL,
-                                  "Rank({}) AsyncThread({}) pushed job from peer={} seq={} to pending jobs queue",
-                                  m_globalRank,
-                                  m_socketThreadId,
-                                  hdr.source_peer,
-                                  hdr.sequence);
-                    pushedToPendingJobs = true;
-                    break;
+                    LOG_HCL_ERR(HCL, "Rank({}) AsyncThread({}) failed to receive data", m_globalRank, m_socketThreadId);
+                    free(pendingJob.jobAddr);
+                    return;
                 }
+                m_PendingJobs.push_back(pendingJob);
+                LOG_HCL_TRACE(HCL,
+                              "Rank({}) AsyncThread({}) pushed job from peer={} seq={} to pending jobs queue",
+                              m_globalRank,
+                              m_socketThreadId,
+                              hdr.source_peer,
+                              hdr.sequence);
+                pushedToPendingJobs = true;
+                break;
             }
             std::this_thread::yield();
         }
@@ -277,7 +302,6 @@ void SocketThread::runAsyncThread()
                       hdr.sequence,
                       loopsCounter);
         pJob.m_handle->setHandleAsDone();
-        m_Asyncjobs[hdr.source_peer].pop();
     }
 }
 
@@ -365,7 +389,11 @@ void SocketThread::stopAsyncThread()
 {
     if (!m_stop)
     {
-        m_stop = true;
+        {
+            std::lock_guard<std::mutex> lock(m_asyncJobsMutex);
+            m_stop = true;
+        }
+        m_asyncJobsCv.notify_one();
         shutdown(m_socket, SHUT_RD);
         if (m_thread.joinable())
         {
@@ -437,7 +465,11 @@ bool SocketThread::pushAsyncJob(ConnectionOperations jobType,
                   peer,
                   sequence,
                   size);
-    m_Asyncjobs[peer].push(job);
+    {
+        std::lock_guard<std::mutex> lock(m_asyncJobsMutex);
+        m_Asyncjobs[peer].push(job);
+    }
+    m_asyncJobsCv.notify_one();
 
     return true;
 }
@@ -1,11 +1,13 @@
 #pragma once
 
-#include <cstddef>  // for size_t
-#include <cstdint>  // for uint32_t
-#include <map>      // for map
-#include <queue>    // for queue
-#include <thread>   // for thread
-#include <vector>   // for vector
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <cstdint>             // for uint32_t
+#include <map>                 // for map
+#include <mutex>               // for mutex
+#include <queue>               // for queue
+#include <thread>              // for thread
+#include <vector>              // for vector
 
 #include "infra/concurrent_unordered_map.hpp"  // for ConcurrentUnorderedMap
 #include "infra/concurrent_queue.hpp"          // for ConcurrentQueue
@@ -72,7 +74,9 @@ private:
     bool executeJob(SocketJob* job);
     bool executeRecv(SocketJob* job);
     bool executeSend(SocketJob* job);
-    void runPendingJobs();
+    bool runPendingJobs();
+    bool anyAsyncJob() const;
+    bool popAsyncJob(HCL_Rank peer, SocketJob& job);
 
     mpsc_fifo_t<SocketJob*, JOBS_QUEUE_CAPACITY> m_jobsQueue;
     std::thread                                  m_thread;
@@ -82,6 +86,8 @@ private:
     int                                          m_socket  = -1;
     bool                                         m_isAsync = false;
     std::map<int, std::queue<SocketJob>>         m_Asyncjobs;
+    std::mutex                                   m_asyncJobsMutex;  // protects m_Asyncjobs
+    std::condition_variable                      m_asyncJobsCv;     // signaled on new async job or stop
     std::vector<PendingJob>                      m_PendingJobs;
 };
 
@@ -0,0 +1,210 @@
+#include "straggler_detector.h"
+
+#include <algorithm>  // for min, max, nth_element, sort
+#include <chrono>     // for steady_clock
+#include <string>     // for string
+
+#include "hcl_log_manager.h"  // for LOG_*
+
+static std::string toString(const std::vector<HCL_Rank>& ranks)
+{
+    std::string str;
+    for (const HCL_Rank rank : ranks)
+    {
+        str += (str.empty() ? "" : ", ") + std::to_string(rank);
+    }
+    return str;
+}
+
+/**
+ * @brief set the related communicator size
+ * coordinator needs to set it when a new communicator is created on bootstrap network
+ */
+void StragglerDetector::setCommSize(const uint32_t size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_commSize = size;
+    m_windows.clear();
+    m_submitted.assign(size, 0);
+}
+
+/**
+ * @brief process a latency report arrived from a rank in communicator
+ * a window is compared once all ranks reported it
+ * @param report - report to process
+ */
+void StragglerDetector::processReport(const LatencyReportMessage& report)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (report.rank >= m_commSize)
+    {
+        LOG_WARN(HCL_COORD, "Latency report of rank({}) out of comm size {}", report.rank, m_commSize);
+        return;
+    }
+    m_submitted[report.rank] = std::max(m_submitted[report.rank], report.submitted);
+
+    if (report.stalled)
+    {
+        processStall(report);
+        return;
+    }
+
+    Window& window = m_windows[report.window];
+    if (window.count == 0)
+    {
+        window.reports.resize(m_commSize);
+        window.received.assign(m_commSize, false);
+    }
+    if (window.received[report.rank]) return;
+
+    window.reports[report.rank]  = report;
+    window.received[report.rank] = true;
+    if (++window.count == m_commSize)
+    {
+        processWindow(report.window, window.reports);
+        m_windows.erase(report.window);
+        return;
+    }
+
+    if (m_windows.size() > MAX_OPEN_WINDOWS)
+    {
+        evictWindow();
+    }
+}
+
+std::vector<RankLateness> StragglerDetector::findStragglers(const std::vector<LatencyReportMessage>& reports,
+                                                            float                                    stragglerFactor)
+{
+    std::vector<RankLateness> lateness(reports.size());
+    for (size_t i = 0; i < reports.size(); i++)
+    {
+        lateness[i] = {reports[i].rank, 0, 0, 0, 0};
+    }
+
+    std::vector<uint32_t> waits;
+    waits.reserve(reports.size());
+    for (unsigned collective = 0; collective < LATENCY_REPORT_COLLECTIVES; collective++)
+    {
+        waits.clear();
+        for (const LatencyReportMessage& report : reports)
+        {
+            if (report.waitUsec[collective] != LATENCY_REPORT_NO_SAMPLE) waits.push_back(report.waitUsec[collective]);
+        }
+        if (waits.size() < 2) continue;
+
+        std::nth_element(waits.begin(), waits.begin() + waits.size() / 2, waits.end());
+        const uint64_t medianUsec = waits[waits.size() / 2];
+
+        for (size_t i = 0; i < reports.size(); i++)
+        {
+            const uint32_t waitUsec = reports[i].waitUsec[collective];
+            if (waitUsec == LATENCY_REPORT_NO_SAMPLE) continue;
+
+            lateness[i].collectives++;
+            if (medianUsec < waitUsec + MIN_LATENESS_USEC || medianUsec < stragglerFactor * waitUsec) continue;
+
+            const uint64_t lateUsec = medianUsec - waitUsec;
+            lateness[i].lateCollectives++;
+            lateness[i].meanLateUsec += lateUsec;  // sum until all collectives are counted
+            lateness[i].maxLateUsec = std::max(lateness[i].maxLateUsec, lateUsec);
+        }
+    }
+
+    std::vector<RankLateness> stragglers;
+    for (RankLateness& rank : lateness)
+    {
+        if (rank.lateCollectives == 0 || rank.lateCollectives * 4 < rank.collectives) continue;
+
+        rank.meanLateUsec /= rank.lateCollectives;
+        stragglers.push_back(rank);
+    }
+
+    std::sort(stragglers.begin(), stragglers.end(), [](const RankLateness& a, const RankLateness& b) {
+        return a.lateCollectives != b.lateCollectives ? a.lateCollectives > b.lateCollectives
+                                                      : a.meanLateUsec > b.meanLateUsec;
+    });
+
+    return stragglers;
+}
+
+void StragglerDetector::processWindow(const uint64_t window, const std::vector<LatencyReportMessage>& reports)
+{
+    const std::vector<RankLateness> stragglers = findStragglers(reports, m_stragglerFactor);
+
+    const uint64_t first = window * LATENCY_REPORT_COLLECTIVES;
+    for (size_t i = 0; i < std::min<size_t>(stragglers.size(), MAX_REPORTED_RANKS); i++)
+    {
+        const RankLateness& straggler = stragglers[i];
+        LOG_WARN(HCL_COORD,
+                 "Straggler rank({}) called {}/{} of collectives [{}, {}) late, by {}us on average, up to {}us",
+                 straggler.rank,
+                 straggler.lateCollectives,
+                 straggler.collectives,
+                 first,
+                 first + LATENCY_REPORT_COLLECTIVES,
+                 straggler.meanLateUsec,
+                 straggler.maxLateUsec);
+    }
+    if (stragglers.size() > MAX_REPORTED_RANKS)
+    {
+        LOG_WARN(HCL_COORD,
+                 "{} more stragglers on collectives [{}, {})",
+                 stragglers.size() - MAX_REPORTED_RANKS,
+                 first,
+                 first + LATENCY_REPORT_COLLECTIVES);
+    }
+}
+
+/**
+ * @brief drop the oldest window, its missing ranks did not complete it or their reports were lost
+ */
+void StragglerDetector::evictWindow()
+{
+    const auto& [window, oldest] = *m_windows.begin();
+
+    std::vector<HCL_Rank> missing;
+    for (HCL_Rank rank = 0; rank < m_commSize && missing.size() < MAX_REPORTED_RANKS; rank++)
+    {
+        if (!oldest.received[rank]) missing.push_back(rank);
+    }
+
+    LOG_WARN(HCL_COORD,
+             "Collectives [{}, {}) not reported by {} ranks, first ones: [{}]",
+             window * LATENCY_REPORT_COLLECTIVES,
+             (window + 1) * LATENCY_REPORT_COLLECTIVES,
+             m_commSize - oldest.count,
+             toString(missing));
+
+    m_windows.erase(m_windows.begin());
+}
+
+/**
+ * @brief name the ranks behind on the host, rate limited since every stalled rank reports
+ */
+void StragglerDetector::processStall(const LatencyReportMessage& report)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (m_lastStallLog.has_value() &&
+        now - *m_lastStallLog < std::chrono::microseconds(CollectiveLatencyStats::STALL_REPORT_INTERVAL_USEC))
+    {
+        return;
+    }
+    m_lastStallLog = now;
+
+    const uint64_t fewest = *std::min_element(m_submitted.begin(), m_submitted.end());
+
+    std::vector<HCL_Rank> behind;
+    for (HCL_Rank rank = 0; rank < m_commSize && behind.size() < MAX_REPORTED_RANKS; rank++)
+    {
+        if (m_submitted[rank] == fewest) behind.push_back(rank);
+    }
+
+    LOG_WARN(HCL_COORD,
+             "Rank({}) waits for collective #{} to complete, fewest submitted collectives {} by ranks [{}]",
+             report.rank,
+             report.window,
+             fewest,
+             toString(behind));
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>    // for steady_clock
+#include <cstdint>   // for uint64_t
+#include <map>       // for map
+#include <mutex>     // for mutex
+#include <optional>  // for optional
+#include <vector>    // for vector
+
+#include "hcl_inc.h"                  // for HCL_Rank
+#include "infra/hcl_latency_stats.h"  // for LatencyReportMessage
+
+/**
+ * @brief how late a rank called the collectives of a report window
+ */
+struct RankLateness
+{
+    HCL_Rank rank;
+    unsigned lateCollectives;  // collectives the rank called late
+    unsigned collectives;      // collectives of the window sampled on the rank
+    uint64_t meanLateUsec;     // mean lateness of the late collectives
+    uint64_t maxLateUsec;
+};
+
+/**
+ * @brief StragglerDetector compares the latency reports of all ranks of a communicator on the coordinator
+ *
+ * Collectives are numbered in the same order on all ranks, and each report holds the device wait of a window of them.
+ * A collective completes on all ranks at about the same time, so a rank that called it later waited less for it on
+ * the device. A rank is late on a collective by the median wait of the ranks minus its own wait, when that is at least
+ * MIN_LATENESS_USEC and the median is at least the straggler factor times its wait. Only host calls are compared, the
+ * hosts' clocks are never.
+ *
+ * Stall reports, of ranks whose collective does not complete, name the ranks that submitted the fewest collectives
+ * by their last report, i.e. the ranks the others wait for.
+ */
+class StragglerDetector
+{
+public:
+    static constexpr uint64_t MIN_LATENESS_USEC  = 100;
+    static constexpr unsigned MAX_OPEN_WINDOWS   = 16;  // windows some rank did not report yet
+    static constexpr unsigned MAX_REPORTED_RANKS = 8;   // ranks named per log line
+
+    explicit StragglerDetector(float stragglerFactor) : m_stragglerFactor(stragglerFactor) {}
+
+    StragglerDetector(StragglerDetector&&)                 = delete;
+    StragglerDetector(const StragglerDetector&)            = delete;
+    StragglerDetector& operator=(StragglerDetector&&)      = delete;
+    StragglerDetector& operator=(const StragglerDetector&) = delete;
+
+    void setCommSize(const uint32_t size);
+    void processReport(const LatencyReportMessage& report);
+
+    /**
+     * @brief find the ranks late on at least a quarter of the sampled collectives of a window
+     * @param reports - the reports of one window, one per rank
+     * @return the stragglers, the most often late first
+     */
+    static std::vector<RankLateness> findStragglers(const std::vector<LatencyReportMessage>& reports,
+                                                    float                                    stragglerFactor);
+
+private:
+    struct Window
+    {
+        std::vector<LatencyReportMessage> reports;
+        std::vector<bool>                 received;  // per rank
+        unsigned                          count = 0;
+    };
+
+    void processWindow(uint64_t window, const std::vector<LatencyReportMessage>& reports);
+    void evictWindow();
+    void processStall(const LatencyReportMessage& report);
+
+    const float m_stragglerFactor;
+
+    std::mutex                 m_mutex;
+    uint32_t                   m_commSize = 0;
+    std::map<uint64_t, Window> m_windows;
+    std::vector<uint64_t>      m_submitted;  // per rank, by its last report
+
+    std::optional<std::chrono::steady_clock::time_point> m_lastStallLog;
+};
@@ -0,0 +1,54 @@
+#include "topology_rank_order.h"
+
+#include <algorithm>      // for stable_sort
+#include <tuple>          // for tie
+#include <unordered_map>  // for unordered_map
+
+std::vector<HCL_Rank> getTopologyRankOrder(const std::vector<RankLocation>& locations)
+{
+    // Group ranks by host, hosts are kept in order of first appearance
+    std::vector<std::vector<HCL_Rank>>      hosts;
+    std::unordered_map<std::string, size_t> hostIndex;
+    for (HCL_Rank rank = 0; rank < locations.size(); rank++)
+    {
+        const auto [it, inserted] = hostIndex.emplace(locations[rank].hostname, hosts.size());
+        if (inserted)
+        {
+            hosts.emplace_back();
+        }
+        hosts[it->second].push_back(rank);
+    }
+
+    std::vector<HCL_Rank> order;
+    order.reserve(locations.size());
+    for (std::vector<HCL_Rank>& hostRanks : hosts)
+    {
+        std::stable_sort(hostRanks.begin(), hostRanks.end(), [&locations](HCL_Rank a, HCL_Rank b) {
+            return std::tie(locations[a].nicNumaNode, locations[a].hwModuleId) <
+                   std::tie(locations[b].nicNumaNode, locations[b].hwModuleId);
+        });
+        order.insert(order.end(), hostRanks.begin(), hostRanks.end());
+    }
+
+    return order;
+}
+
+bool isOrderBoxAligned(const std::vector<HCL_Rank>&     order,
+                       const std::vector<RankLocation>& locations,
+                       uint32_t                         boxSize)
+{
+    if (boxSize == 0) return false;
+
+    for (size_t first = 0; first < order.size(); first += boxSize)
+    {
+        const size_t last = std::min(first + boxSize, order.size());
+        for (size_t pos = first + 1; pos < last; pos++)
+        {
+            if (locations[order[pos]].hostname != locations[order[first]].hostname)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>          // for uint32_t
+#include <string>           // for string
+#include <vector>           // for vector
+#include "hcl_inc.h"        // for HCL_Rank
+
+/**
+ * @brief Physical location of a rank, as used by the topology-aware rank ordering
+ */
+struct RankLocation
+{
+    std::string hostname;          // ranks of the same host share a scale-up box
+    uint32_t    hwModuleId  = 0;   // device module inside the box, owns the device's scale-out ports
+    int         nicNumaNode = -1;  // NUMA node of the host NIC serving the rank, -1 if there is none
+};
+
+/**
+ * @brief Find a rank order that follows the physical layout of the ranks.
+ *
+ * Ranks of the same host become contiguous, so every scale-up group (rank / boxSize) is a real box and ring or
+ * pairwise neighbours stay inside it. Within a host ranks are ordered by the NUMA node of their host NIC and then by
+ * module ID. Homogeneous boxes therefore get the same order, and the scale-out peers (rank % boxSize) sit on the same
+ * module ports and NIC rail. Hosts keep the order of their lowest current rank.
+ *
+ * The order depends only on the given locations, so a synthetic topology can be fed to it.
+ *
+ * @param locations location of every rank, indexed by its current rank
+ * @return current ranks in topology order, i.e. order[topologyRank] = currentRank
+ */
+std::vector<HCL_Rank> getTopologyRankOrder(const std::vector<RankLocation>& locations);
+
+/**
+ * @brief Check whether every scale-up group of an order is made of ranks of a single host.
+ *
+ * @param order rank order, as returned by getTopologyRankOrder
+ * @param locations location of every rank, indexed by its current rank
+ * @param boxSize number of ranks in a scale-up group
+ * @return true if no scale-up group spans hosts
+ */
+bool isOrderBoxAligned(const std::vector<HCL_Rank>&     order,
+                       const std::vector<RankLocation>& locations,
+                       uint32_t                         boxSize);
@@ -0,0 +1,46 @@
+#include "hcl_comm_config.h"
+
+#include "hcl_global_conf.h"  // for GCFG_*
+
+void HclCommConfig::init(const uint32_t commSize)
+{
+    boxType      = (HclConfigType)GCFG_BOX_TYPE_ID.value();
+    nullSubmit   = GCFG_HCL_NULL_SUBMIT.value();
+    latencyStats = GCFG_HCL_LATENCY_STATS.value();
+
+    dependencyChecker = GCFG_ENABLE_DEPENDENCY_CHECKER.value();
+    checkDependencies = dependencyChecker && !GCFG_WEAK_ORDER.value();
+    weakOrderOverride = !GCFG_WEAK_ORDER.isSetFromDefault();
+    weakOrder         = GCFG_WEAK_ORDER.value();
+
+    submitThresholdSet         = GCFG_HCL_SUBMIT_THRESHOLD.isSetFromUserConfig();
+    submitThreshold            = GCFG_HCL_SUBMIT_THRESHOLD.value();
+    collectivePipelining       = GCFG_HCL_COLLECTIVE_PIPELINING.value();
+    minImbSizeFactor           = GCFG_HCL_MIN_IMB_SIZE_FACTOR.value();
+    hnicLtu                    = GCFG_HCL_HNIC_LTU.value();
+    complexBcastMinSize        = GCFG_HCL_COMPLEX_BCAST_MIN_SIZE.value();
+    useSinglePeerBroadcast     = GCFG_HCL_USE_SINGLE_PEER_BROADCAST.value();
+    singlePeerBroadcastAllowed = GCFG_HCL_IS_SINGLE_PEER_BROADCAST_ALLOWED.value();
+    bcastPipelineMinSize       = GCFG_HCL_BCAST_PIPELINE_MIN_SIZE.value();
+    bcastPipelineMinBoxes      = GCFG_HCL_BCAST_PIPELINE_MIN_BOXES.value();
+    bcastPipelineSliceSize     = GCFG_HCL_BCAST_PIPELINE_SLICE_SIZE.value();
+    all2allSchedule            = GCFG_HCL_ALL2ALL_SCHEDULE.value();
+    all2allScheduleSeed        = GCFG_HCL_ALL2ALL_SCHEDULE_SEED.value();
+
+    if (GCFG_HCCL_OVER_OFI.value())
+    {
+        maxScaleOutQpSets = commSize < GCFG_HCL_HNIC_QP_SETS_COMM_SIZE_THRESHOLD.value()
+                                ? GCFG_HCL_HNIC_SCALE_OUT_QP_SETS.value()
+                                : 1;
+        qpSprayThreshold  = GCFG_HCL_HNIC_QP_SPRAY_THRESHOLD.value();
+    }
+    else
+    {
+        maxScaleOutQpSets = commSize < GCFG_HCL_GNIC_QP_SETS_COMM_SIZE_THRESHOLD.value()
+                                ? GCFG_HCL_GNIC_SCALE_OUT_QP_SETS.value()
+                                : 1;
+        qpSprayThreshold  = GCFG_HCL_GNIC_QP_SPRAY_THRESHOLD.value();
+    }
+    qpSetStripeSize  = GCFG_HCL_SCALE_OUT_QP_SET_STRIPE_SIZE.value();
+    hnicMicroStreams = GCFG_ENABLE_HNIC_MICRO_STREAMS.value();
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>  // for uint32_t, uint64_t
+
+#include "hcl_types.h"  // for HclConfigType
+
+/**
+ * @struct HclCommConfig holds the configuration values read on the hot paths of a communicator (collective and
+ * send/recv scheduling, scaleout QP selection, host NIC descriptors).
+ *
+ * GCFG items are not changed once the communicator exists, but every value() call goes through the config item
+ * accessor. The values are copied once when the communicator is initialized and the hot paths read plain members.
+ * Items that are only read on init or on error paths keep using GCFG directly.
+ */
+struct HclCommConfig
+{
+    void init(const uint32_t commSize);
+
+    HclConfigType boxType      = UNKNOWN;
+    bool          nullSubmit   = false;
+    bool          latencyStats = false;
+
+    // ordering
+    bool dependencyChecker = false;  // HCL dependency checker is enabled
+    bool checkDependencies = false;  // dependency checker is enabled and weak order is not forced
+    bool weakOrderOverride = false;  // weak order was set by the user, overrides the per op flag
+    bool weakOrder         = false;
+
+    // collectives
+    bool     submitThresholdSet         = false;  // HW submit is batched only when the user set a threshold
+    uint64_t submitThreshold            = 0;
+    bool     collectivePipelining       = false;
+    uint64_t minImbSizeFactor           = 1;
+    bool     hnicLtu                    = false;
+    uint64_t complexBcastMinSize        = 0;
+    bool     useSinglePeerBroadcast     = false;
+    bool     singlePeerBroadcastAllowed = false;
+    uint64_t bcastPipelineMinSize       = 0;
+    uint64_t bcastPipelineMinBoxes      = 0;
+    uint64_t bcastPipelineSliceSize     = 0;
+    uint64_t all2allSchedule            = 0;
+    uint64_t all2allScheduleSeed        = 0;
+
+    // scaleout
+    unsigned maxScaleOutQpSets = 1;
+    uint64_t qpSprayThreshold  = 0;
+    uint64_t qpSetStripeSize   = 0;
+    bool     hnicMicroStreams  = false;
+};
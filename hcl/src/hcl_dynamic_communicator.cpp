@@ -28,10 +28,8 @@
 
 class IHclDevice;
 
-static constexpr unsigned MAX_SEND_RECV_PEER_COUNTER = 16;
-
 HclDynamicCommunicator::HclDynamicCommunicator(const HCL_Comm comm, Gen2ArchServerDef& serverDef, hcl::HalPtr hal)
-: m_commId(comm), m_serverDef(serverDef), m_hal(hal)
+: m_latencyStats(comm), m_commId(comm), m_serverDef(serverDef), m_hal(hal)
 {
     m_streamLatestLongSo.resize(m_hal->getMaxStreams());
     m_streamLatestLongSo.assign(m_hal->getMaxStreams(), 0);
@@ -67,6 +65,7 @@ bool HclDynamicCommunicator::init(const uint32_t hcclCommSize, const HCL_Rank ra
                   box_size);
 
     m_commSize = hcclCommSize;
+    m_config.init(hcclCommSize);
 
     // allocate maps memory
     m_rankToScaleupGroupMap.resize(hcclCommSize, INVALID_SCALEUP_GROUP);
@@ -80,8 +79,10 @@ bool HclDynamicCommunicator::init(const uint32_t hcclCommSize, const HCL_Rank ra
         m_remoteDevices[i] = std::make_unique<HclRemoteDevice>();
     }
 
-    m_sendCounter.clear();
-    m_recvCounter.clear();
+    m_sendCounter.assign(hcclCommSize, 0);
+    m_recvCounter.assign(hcclCommSize, 0);
+
+    m_metrics = HclMetricsExporter::registerComm(getCommUniqueId(), m_commId, rank, hcclCommSize);
 
     return true;
 }
@@ -310,26 +311,25 @@ const uint64_t HclDynamicCommunicator::getCollectiveCtr() const
     return m_collectiveCtr;
 }
 
+// peer is not validated yet when the counters are updated, an invalid peer has no counter
 const uint64_t HclDynamicCommunicator::incSendCtr(int peer)
 {
-    return (m_sendCounter.size() < MAX_SEND_RECV_PEER_COUNTER || m_sendCounter.count(peer) > 0) ? ++m_sendCounter[peer]
-                                                                                                : 0;
+    return (unsigned)peer < m_sendCounter.size() ? ++m_sendCounter[peer] : 0;
 }
 
 const uint64_t HclDynamicCommunicator::getSendCtr(int peer)
 {
-    return m_sendCounter.count(peer) > 0 ? m_sendCounter[peer] : 0;
+    return (unsigned)peer < m_sendCounter.size() ? m_sendCounter[peer] : 0;
 }
 
 const uint64_t HclDynamicCommunicator::incRecvCtr(int peer)
 {
-    return (m_recvCounter.size() < MAX_SEND_RECV_PEER_COUNTER || m_recvCounter.count(peer) > 0) ? ++m_recvCounter[peer]
-                                                                                                : 0;
+    return (unsigned)peer < m_recvCounter.size() ? ++m_recvCounter[peer] : 0;
 }
 
 const uint64_t HclDynamicCommunicator::getRecvCtr(int peer)
 {
-    return m_recvCounter.count(peer) > 0 ? m_recvCounter[peer] : 0;
+    return (unsigned)peer < m_recvCounter.size() ? m_recvCounter[peer] : 0;
 }
 
 uint32_t HclDynamicCommunicator::getCommSize()
@@ -489,6 +489,29 @@ hcclResult_t HclDynamicCommunicator::setCommScaleupGroupSize()
             LOG_HCL_ERR(HCL, "Invalid ranksInBox size {}", ranksInBox);
             return hcclInternalError;
         }
+
+        // The scaleup/scaleout split derives box membership from the rank order (rank / ScaleupGroupSize). Warn when
+        // the ranks of my ScaleupGroup are not the devices of my box, such a comm runs but its ScaleupGroup traffic
+        // does not stay inside the box.
+        const HCL_Rank firstRankInGroup = m_rankInfo.header.hcclRank - mod(m_rankInfo.header.hcclRank, ranksInBox);
+        for (HCL_Rank rank = firstRankInGroup; rank < firstRankInGroup + ranksInBox && rank < m_commSize; rank++)
+        {
+            const RankInfoHeader& header = m_remoteDevices[rank]->header;
+            if (strncmp(header.hostname, m_rankInfo.header.hostname, HOSTNAME_MAX_LENGTH) != 0 ||
+                hwModulesInBox.count(header.hwModuleID) == 0)
+            {
+                LOG_HCL_WARN(HCL,
+                             "Comm ({}) rank {} (host {}, hwModuleID {}) is in the same ScaleupGroup as rank {} "
+                             "(host {}) but not in its box, ranks of the same box are expected to be consecutive",
+                             m_commId,
+                             rank,
+                             header.hostname,
+                             header.hwModuleID,
+                             m_rankInfo.header.hcclRank,
+                             m_rankInfo.header.hostname);
+                break;
+            }
+        }
     }
 
     std::vector<uint32_t> hostSizes(m_commSize, 0);
@@ -516,6 +539,13 @@ hcclResult_t HclDynamicCommunicator::setCommScaleupGroupSize()
     }
 
     LOG_HCL_DEBUG(HCL, "ScaleupGroup size for comm ({}) was set to ({})", m_commId, m_scaleupGroupSize);
+    LOG_HCL_INFO(HCL,
+                 "Comm ({}) uses {} schedule: ScaleupGroup size {}, {} ScaleupGroups",
+                 m_commId,
+                 isCommunicatorMultiScaleupGroup() ? (m_scaleupGroupSize > 1 ? "scaleup+scaleout" : "scaleout peers")
+                                                   : "scaleup only",
+                 m_scaleupGroupSize,
+                 div((uint32_t)m_commSize, (uint32_t)m_scaleupGroupSize));
     return hcclSuccess;
 }
 
@@ -591,16 +621,23 @@ void HclDynamicCommunicator::setRankInScaleupGroup()
 
 unsigned HclDynamicCommunicator::getMaxScaleOutQpSetsNum()
 {
-    if (GCFG_HCCL_OVER_OFI.value())
+    return m_config.maxScaleOutQpSets;
+}
+
+unsigned HclDynamicCommunicator::getScaleOutQpSetsNum(const uint64_t transactionSize)
+{
+    // Small transactions stay on a single QP set, larger ones are spread over more sets as they grow.
+    // Depends only on the transaction size, so both sides of a connection pick the same QP sets.
+    const unsigned maxQpSets = m_config.maxScaleOutQpSets;
+    if (maxQpSets <= 1 || transactionSize <= m_config.qpSprayThreshold)
     {
-        return (unsigned)m_commSize < GCFG_HCL_HNIC_QP_SETS_COMM_SIZE_THRESHOLD.value()
-                   ? GCFG_HCL_HNIC_SCALE_OUT_QP_SETS.value()
-                   : 1;
+        return 1;
     }
-    else
+
+    if (m_config.qpSetStripeSize == 0)
     {
-        return (unsigned)m_commSize < GCFG_HCL_GNIC_QP_SETS_COMM_SIZE_THRESHOLD.value()
-                   ? GCFG_HCL_GNIC_SCALE_OUT_QP_SETS.value()
-                   : 1;
+        return maxQpSets;
     }
+
+    return (unsigned)std::min<uint64_t>(maxQpSets, div_round_up(transactionSize, m_config.qpSetStripeSize));
 }
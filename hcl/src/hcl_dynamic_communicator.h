@@ -4,7 +4,6 @@
 #include <cstdint>  // for uint16_t
 #include <vector>   // for vector
 #include <memory>   // for allocator, unique_ptr
-#include <map>
 
 #include "hcl_api_types.h"                        // for HCL_Rank
 #include "hccl_types.h"                           // for hcclResult_t
@@ -14,6 +13,9 @@
 #include "hccl/ofi_communicator.h"                // for ofi_communicator_handle
 #include "interfaces/hcl_hal.h"                   // for HalPtr
 #include "hccl_internal_defs.h"                   // for internal_unique_id_t
+#include "infra/hcl_latency_stats.h"              // for CollectiveLatencyStats
+#include "infra/hcl_metrics.h"                    // for HclCommMetrics
+#include "hcl_comm_config.h"                      // for HclCommConfig
 
 class HclStaticBuffersManager;
 class IHclDevice;
@@ -75,7 +77,9 @@ public:
     HCL_Rank                  getRankInScaleupGroup() const;
     void                      setRankInScaleupGroup();
     unsigned                  getMaxScaleOutQpSetsNum();
+    unsigned                  getScaleOutQpSetsNum(const uint64_t transactionSize);
     uint64_t                  getSliceSize() const;
+    const HclCommConfig&      getConfig() const { return m_config; }
 
     hcclResult_t      prepareAndValidateComm(bool isLoopbackModeOrNullSubmission = false);
     void              AddNewRemoteDevice(HCL_Rank newRank);
@@ -99,6 +103,11 @@ public:
 
     std::vector<uint64_t> m_streamLatestLongSo;
 
+    CollectiveLatencyStats m_latencyStats;
+
+    // Throughput counters of the metrics exporter, null when metrics are not exported
+    std::shared_ptr<HclCommMetrics> m_metrics;
+
     operator HCL_Comm() const { return m_commId; }
 
 private:
@@ -122,8 +131,8 @@ private:
     std::vector<uint32_t> m_rankToScaleupGroupMap = {};
     std::vector<HCL_Rank> m_scaleupGroupToRankMap = {};
 
-    std::map<int, uint64_t> m_sendCounter;
-    std::map<int, uint64_t> m_recvCounter;
+    std::vector<uint64_t> m_sendCounter;  // send calls per peer rank
+    std::vector<uint64_t> m_recvCounter;  // recv calls per peer rank
 
     internal_unique_id_t  m_commUniqueId;
     std::string           m_commUniqueIdStr;
@@ -132,4 +141,5 @@ private:
     std::vector<HCL_Rank> m_remoteRanks   = {};
     uint64_t              m_collectiveCtr = 0;
     uint64_t              m_sliceSize;
+    HclCommConfig         m_config;
 };
\ No newline at end of file
@@ -56,6 +56,26 @@ GlobalConfSize GCFG_HCL_GDR_SLICE_SIZE(
         DfltSize(hl_gcfg::SizeParam("2MB")),
         MakePrivate);
 
+GlobalConfUint64 GCFG_HCL_IMB_SCALEOUT_POOL_COUNT(
+        "HCL_IMB_SCALEOUT_POOL_COUNT",
+        "Amount of scaleout intermediate buffers per stream, must be divisible by HCL_SCALEOUT_BUFFER_FACTOR "
+        "(0 - use built-in default)",
+        0,
+        MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_IMB_SCALEUP_POOL_COUNT(
+        "HCL_IMB_SCALEUP_POOL_COUNT",
+        "Amount of scaleup/all2all intermediate buffers per stream, must be divisible by 8 (0 - use built-in default)",
+        0,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_IMB_HBM_BUDGET(
+        "HCL_IMB_HBM_BUDGET",
+        "Upper bound on HBM used by intermediate buffers of all streams, pools are shrunk to fit but not below their "
+        "minimal credits (0 - unlimited)",
+        DfltSize(hl_gcfg::SizeParam("0")),
+        MakePrivate);
+
 GlobalConfSize GCFG_FW_IMB_SIZE(
         "FW_IMB_SIZE",
         "FW static intermediate buffer size for Gen2Arch only (G2 on SRAM, G3 on HBM)",
@@ -169,6 +189,12 @@ GlobalConfBool GCFG_ENABLE_DEPENDENCY_CHECKER(
     true,
     MakePrivate);
 
+GlobalConfBool GCFG_HCL_COLLECTIVE_PIPELINING(
+    "HCL_COLLECTIVE_PIPELINING",
+    "When true, AllReduce buffer dependencies are tracked per slice, so slices of a collective that do not overlap in-flight work may start while the previous collective drains",
+    false,
+    MakePrivate);
+
 GlobalConfUint64 GCFG_LOOPBACK_COMMUNICATOR_SIZE(
         "LOOPBACK_COMMUNICATOR_SIZE",
         "For loopback tests only - determines the communicator size (Min: 2, Max: 8)",
@@ -254,12 +280,43 @@ GlobalConfBool GCFG_HCL_USE_SINGLE_PEER_BROADCAST(
         false,
         MakePrivate);
 
+GlobalConfSize GCFG_HCL_BCAST_PIPELINE_MIN_SIZE(
+        "HCL_BCAST_PIPELINE_MIN_SIZE",
+        "Threshold to run broadcast as a pipelined chain of boxes over scaleout (0 - disabled)",
+        DfltSize(hl_gcfg::SizeParam("0")),
+        MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_BCAST_PIPELINE_MIN_BOXES(
+        "HCL_BCAST_PIPELINE_MIN_BOXES",
+        "Minimal number of scaleup groups for the pipelined chain broadcast",
+        3,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_BCAST_PIPELINE_SLICE_SIZE(
+        "HCL_BCAST_PIPELINE_SLICE_SIZE",
+        "Size of the slices forwarded box to box by the pipelined chain broadcast",
+        DfltSize(hl_gcfg::SizeParam("4MB")),
+        MakePrivate);
+
 GlobalConfBool GCFG_HCL_IS_SINGLE_PEER_BROADCAST_ALLOWED(
         "HCL_IS_SINGLE_PEER_BROADCAST_ALLOWED",
         "Is single peer broadcast allowed",
         DfltBool(false) << deviceValue(synDeviceGaudi2, true),
         MakePrivate);
 
+GlobalConfUint64 GCFG_HCL_ALL2ALL_SCHEDULE(
+        "HCL_ALL2ALL_SCHEDULE",
+        "All2All scaleout peer order: 0 - shifted, 1 - XOR pairwise exchange (power of 2 boxes), "
+        "2 - shifted with randomized step order",
+        0,
+        MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_ALL2ALL_SCHEDULE_SEED(
+        "HCL_ALL2ALL_SCHEDULE_SEED",
+        "Seed of the randomized All2All schedule, must be identical on all ranks",
+        0,
+        MakePrivate);
+
 GlobalConfBool GCFG_HCL_LOG_CONTEXT(
         "HCL_LOG_CONTEXT",
         "Indent in context log lines for easier debug",
@@ -362,6 +419,45 @@ GlobalConfInt64  GCFG_OP_DRIFT_THRESHOLD_MS(
         10000,
         MakePublic);
 
+GlobalConfBool GCFG_HCL_LATENCY_STATS(
+    "HCL_LATENCY_STATS",
+    "Keep per communicator collective latency histograms, and report every 64 collectives the device waits of each "
+    "rank to the coordinator, which logs the ranks that call collectives late and the ranks a stalled collective "
+    "waits for",
+    false,
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_LATENCY_STATS_INTERVAL(
+    "HCL_LATENCY_STATS_INTERVAL",
+    "Every this many completed collectives each rank logs the latency histograms of the window, 0 disables",
+    DfltUint64(1000),
+    MakePrivate);
+
+GlobalConfFloat GCFG_HCL_STRAGGLER_FACTOR(
+    "HCL_STRAGGLER_FACTOR",
+    "A rank is late on a collective when the median device wait of the ranks is this many times its own wait",
+    DfltFloat(2.0),
+    MakePrivate);
+
+GlobalConfString GCFG_HCL_METRICS_DIR(
+    "HCL_METRICS_DIR",
+    "Directory the per device metrics file (Prometheus text format) is written to, empty disables the exporter",
+    std::string(""),
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_METRICS_INTERVAL_MS(
+    "HCL_METRICS_INTERVAL_MS",
+    "Metrics exporter sample interval in milliseconds",
+    DfltUint64(10000),
+    MakePrivate);
+
+GlobalConfString GCFG_HCL_NODE_CACHE_DIR(
+    "HCL_NODE_CACHE_DIR",
+    "Node local directory caching the hwloc topology and kernel capability probes across process restarts, empty "
+    "disables the cache",
+    std::string(""),
+    MakePrivate);
+
 GlobalConfUint64 GCFG_SCALE_OUT_PORTS_MASK(
         "SCALE_OUT_PORTS_MASK",
         "Port mask to enable / disable scaleout ports (e.g. 0xc00000)",
@@ -445,12 +541,101 @@ GlobalConfUint64 GCFG_HCL_HNIC_QP_SETS_COMM_SIZE_THRESHOLD(
     DfltUint64(2000),
     MakePrivate);
 
+GlobalConfSize GCFG_HCL_GNIC_QP_SPRAY_THRESHOLD(
+    "HCL_GNIC_QP_SPRAY_THRESHOLD",
+    "Threshold of transaction size from which GNIC QP packet spray is enabled",
+    DfltSize(hl_gcfg::SizeParam("64kb")),
+    MakePrivate);
+
 GlobalConfSize GCFG_HCL_HNIC_QP_SPRAY_THRESHOLD(
     "HCL_HNIC_QP_SPRAY_THRESHOLD",
     "Threshold of transaction size from which HNIC QP packet spray is enabled",
     DfltSize(hl_gcfg::SizeParam("256kb")),
     MakePrivate);
 
+GlobalConfSize GCFG_HCL_SCALE_OUT_QP_SET_STRIPE_SIZE(
+    "HCL_SCALE_OUT_QP_SET_STRIPE_SIZE",
+    "Above the spray threshold, a scale-out transaction is striped over one QP set per this many bytes, "
+    "0 stripes it over all QP sets",
+    DfltSize(hl_gcfg::SizeParam("256kb")),
+    MakePrivate);
+
+GlobalConfBool GCFG_HCL_SCALE_OUT_PORT_HEALTH_CHECK(
+    "HCL_SCALE_OUT_PORT_HEALTH_CHECK",
+    "The ranks of a communicator agree on unhealthy scale-out ports during its init and every "
+    "HCL_SCALE_OUT_PORT_HEALTH_INTERVAL collectives, and it does not use them",
+    false,
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_SCALE_OUT_PORT_ERROR_THRESHOLD(
+    "HCL_SCALE_OUT_PORT_ERROR_THRESHOLD",
+    "New scale-out port error counts between two health checks from which the port is degraded, 0 disables",
+    DfltUint64(16),
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_SCALE_OUT_PORT_HEALTH_INTERVAL(
+    "HCL_SCALE_OUT_PORT_HEALTH_INTERVAL",
+    "Collectives of a communicator between two scale-out port health checks. A change of the agreed ports drains the "
+    "communicator's streams and reconnects its scale-out. 0 checks at communicator init only",
+    DfltUint64(10000),
+    MakePrivate);
+
+GlobalConfSize GCFG_HCL_HNIC_EAGER_MAX_SIZE(
+    "HCL_HNIC_EAGER_MAX_SIZE",
+    "Host NIC messages up to this size are received into preposted eager slots, 0 disables eager messages. Must be "
+    "the same on all ranks",
+    DfltSize(hl_gcfg::SizeParam("8kb")),
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_HNIC_EAGER_SEND_SLOTS(
+    "HCL_HNIC_EAGER_SEND_SLOTS",
+    "Number of eager send staging slots per host NIC communicator, a staged send is signaled on post",
+    128,
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_HNIC_EAGER_RECV_SLOTS(
+    "HCL_HNIC_EAGER_RECV_SLOTS",
+    "Number of eager recv slots preposted per host NIC connection, 0 disables eager messages. Must be the same on "
+    "all ranks",
+    8,
+    MakePrivate);
+
+GlobalConfBool GCFG_HCL_HNIC_NUMA_AFFINITY(
+    "HCL_HNIC_NUMA_AFFINITY",
+    "Place host scheduler threads and host NIC staging buffers on the NIC's NUMA node",
+    true,
+    MakePrivate);
+
+GlobalConfBool GCFG_HCL_HNIC_STAGING_HUGE_PAGES(
+    "HCL_HNIC_STAGING_HUGE_PAGES",
+    "Back host NIC staging buffers with huge pages when available",
+    true,
+    MakePrivate);
+
+GlobalConfBool GCFG_HCL_HNIC_ADAPTIVE_CONGESTION_WINDOW(
+    "HCL_HNIC_ADAPTIVE_CONGESTION_WINDOW",
+    "Limit host NIC sends in flight per communicator and QP set with a window adapted to completion latency",
+    false,
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_HNIC_CONGESTION_WINDOW_MAX(
+    "HCL_HNIC_CONGESTION_WINDOW_MAX",
+    "Largest adaptive congestion window, in sends in flight",
+    256,
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_HNIC_CONGESTION_TARGET_DELAY_PERCENT(
+    "HCL_HNIC_CONGESTION_TARGET_DELAY_PERCENT",
+    "Completion latency above the lowest observed one, in percent of it, before the window shrinks",
+    50,
+    MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_HNIC_CONGESTION_MAX_STALL_USEC(
+    "HCL_HNIC_CONGESTION_MAX_STALL_USEC",
+    "Longest time in usec a full congestion window holds back sends before one is posted anyway",
+    1000,
+    MakePrivate);
+
 GlobalConfBool GCFG_HCL_ENABLE_G3_SR_AGG(
         "HCL_ENABLE_G3_SR_AGG",
         "For G3 send/receive, enable NIC commands aggregation",
@@ -500,12 +685,26 @@ GlobalConfUint64 GCFG_HCL_HLCP_SERVER_IO_THREADS(
         4,
         MakePrivate);
 
+GlobalConfBool GCFG_HCL_HLCP_IO_URING(
+        "HCL_HLCP_IO_URING",
+        "HLCP IO threads wait for socket events with io_uring instead of epoll (falls back to epoll if not available). "
+        "Only the event waits and re-arms are batched, each socket read and write is still its own syscall, there is "
+        "no multishot accept or recv",
+        false,
+        MakePrivate);
+
 GlobalConfUint64 GCFG_HCL_HLCP_SERVER_SEND_THREAD_RANKS(
         "HCL_HLCP_SERVER_SEND_THREAD_RANKS",
         "Number of ranks to handle in one send thread. (num of threads == comm_size / ranks_in_thread)",
         8,
         MakePrivate);
 
+GlobalConfUint64 GCFG_HCL_COORDINATOR_SEND_THREADS(
+        "HCL_COORDINATOR_SEND_THREADS",
+        "Maximum number of threads the legacy coordinator uses to send a bootstrap phase reply to all ranks",
+        32,
+        MakePrivate);
+
 GlobalConfUint64 GCFG_HCL_HLCP_OPS_TIMEOUT(
         "HCL_HLCP_OPS_TIMEOUT",
         "HLCP operation timeout (seconds)",
@@ -18,6 +18,9 @@ extern GlobalConfUint64 GCFG_HCL_MIN_IMB_SIZE_FACTOR;
 extern GlobalConfUint64 GCFG_HCL_SCALEOUT_BUFFER_FACTOR;
 extern GlobalConfSize   GCFG_HCL_SLICE_SIZE;
 extern GlobalConfSize   GCFG_HCL_GDR_SLICE_SIZE;
+extern GlobalConfUint64 GCFG_HCL_IMB_SCALEOUT_POOL_COUNT;
+extern GlobalConfUint64 GCFG_HCL_IMB_SCALEUP_POOL_COUNT;
+extern GlobalConfSize   GCFG_HCL_IMB_HBM_BUDGET;
 extern GlobalConfUint64 GCFG_HCL_DEBUG_STATS_LEVEL;
 extern GlobalConfString GCFG_HCL_DEBUG_STATS_FILE;
 extern GlobalConfString GCFG_HABANA_PROFILE;
@@ -34,6 +37,7 @@ extern GlobalConfUint64 GCFG_BOX_TYPE_ID;
 extern GlobalConfString GCFG_BOX_TYPE;
 extern GlobalConfBool   GCFG_WEAK_ORDER;
 extern GlobalConfBool   GCFG_ENABLE_DEPENDENCY_CHECKER;
+extern GlobalConfBool   GCFG_HCL_COLLECTIVE_PIPELINING;
 extern GlobalConfBool   GCFG_NOTIFY_ON_CCB_HALF_FULL_FOR_DBM;
 extern GlobalConfUint64 GCFG_LOOPBACK_COMMUNICATOR_SIZE;
 extern GlobalConfUint64 GCFG_LOOPBACK_SCALEUP_GROUP_SIZE;
@@ -48,16 +52,21 @@ extern GlobalConfString GCFG_HCCL_SOCKET_IFNAME;
 extern GlobalConfString GCFG_HCCL_COMM_ID;
 extern GlobalConfInt64  GCFG_HCCL_TRIALS;
 
-extern GlobalConfSize GCFG_HCL_COMPLEX_BCAST_MIN_SIZE;
-extern GlobalConfBool GCFG_HCL_USE_SINGLE_PEER_BROADCAST;
-extern GlobalConfBool GCFG_HCL_IS_SINGLE_PEER_BROADCAST_ALLOWED;
+extern GlobalConfSize   GCFG_HCL_COMPLEX_BCAST_MIN_SIZE;
+extern GlobalConfBool   GCFG_HCL_USE_SINGLE_PEER_BROADCAST;
+extern GlobalConfSize   GCFG_HCL_BCAST_PIPELINE_MIN_SIZE;
+extern GlobalConfUint64 GCFG_HCL_BCAST_PIPELINE_MIN_BOXES;
+extern GlobalConfSize   GCFG_HCL_BCAST_PIPELINE_SLICE_SIZE;
+extern GlobalConfBool   GCFG_HCL_IS_SINGLE_PEER_BROADCAST_ALLOWED;
+extern GlobalConfUint64 GCFG_HCL_ALL2ALL_SCHEDULE;
+extern GlobalConfUint64 GCFG_HCL_ALL2ALL_SCHEDULE_SEED;
 
-extern GlobalConfBool  GCFG_HCL_LOG_CONTEXT;
-extern GlobalConfInt64 GCFG_HOST_SCHEDULER_SLEEP_THRESHOLD;
-extern GlobalConfInt64 GCFG_HOST_SCHEDULER_SLEEP_DURATION;
-extern GlobalConfInt64 GCFG_HOST_SCHEDULER_THREADS;
-extern GlobalConfInt64 GCFG_HOST_SCHEDULER_STREAM_DEPTH_PROC;
-extern GlobalConfInt64 GCFG_OFI_CQ_BURST_PROC;
+extern GlobalConfBool   GCFG_HCL_LOG_CONTEXT;
+extern GlobalConfInt64  GCFG_HOST_SCHEDULER_SLEEP_THRESHOLD;
+extern GlobalConfInt64  GCFG_HOST_SCHEDULER_SLEEP_DURATION;
+extern GlobalConfInt64  GCFG_HOST_SCHEDULER_THREADS;
+extern GlobalConfInt64  GCFG_HOST_SCHEDULER_STREAM_DEPTH_PROC;
+extern GlobalConfInt64  GCFG_OFI_CQ_BURST_PROC;
 
 extern GlobalConfSize GCFG_MTU_SIZE;
 extern GlobalConfSize GCFG_HCL_SRAM_SIZE_RESERVED_FOR_HCL;
@@ -72,6 +81,12 @@ extern GlobalConfBool GCFG_HCL_NULL_SUBMIT;
 
 extern GlobalConfBool   GCFG_HCL_COLLECTIVE_LOG;
 extern GlobalConfInt64  GCFG_OP_DRIFT_THRESHOLD_MS;
+extern GlobalConfBool   GCFG_HCL_LATENCY_STATS;
+extern GlobalConfUint64 GCFG_HCL_LATENCY_STATS_INTERVAL;
+extern GlobalConfFloat  GCFG_HCL_STRAGGLER_FACTOR;
+extern GlobalConfString GCFG_HCL_METRICS_DIR;
+extern GlobalConfString GCFG_HCL_NODE_CACHE_DIR;
+extern GlobalConfUint64 GCFG_HCL_METRICS_INTERVAL_MS;
 extern GlobalConfUint64 GCFG_SCALE_OUT_PORTS_MASK;
 extern GlobalConfUint64 GCFG_LOGICAL_SCALE_OUT_PORTS_MASK;
 extern GlobalConfString GCFG_HCL_PORT_MAPPING_CONFIG;
@@ -87,7 +102,21 @@ extern GlobalConfUint64 GCFG_HCL_GNIC_SCALE_OUT_QP_SETS;
 extern GlobalConfUint64 GCFG_HCL_HNIC_SCALE_OUT_QP_SETS;
 extern GlobalConfUint64 GCFG_HCL_GNIC_QP_SETS_COMM_SIZE_THRESHOLD;
 extern GlobalConfUint64 GCFG_HCL_HNIC_QP_SETS_COMM_SIZE_THRESHOLD;
+extern GlobalConfSize   GCFG_HCL_GNIC_QP_SPRAY_THRESHOLD;
 extern GlobalConfSize   GCFG_HCL_HNIC_QP_SPRAY_THRESHOLD;
+extern GlobalConfSize   GCFG_HCL_SCALE_OUT_QP_SET_STRIPE_SIZE;
+extern GlobalConfBool   GCFG_HCL_SCALE_OUT_PORT_HEALTH_CHECK;
+extern GlobalConfUint64 GCFG_HCL_SCALE_OUT_PORT_ERROR_THRESHOLD;
+extern GlobalConfUint64 GCFG_HCL_SCALE_OUT_PORT_HEALTH_INTERVAL;
+extern GlobalConfSize   GCFG_HCL_HNIC_EAGER_MAX_SIZE;
+extern GlobalConfUint64 GCFG_HCL_HNIC_EAGER_SEND_SLOTS;
+extern GlobalConfUint64 GCFG_HCL_HNIC_EAGER_RECV_SLOTS;
+extern GlobalConfBool   GCFG_HCL_HNIC_NUMA_AFFINITY;
+extern GlobalConfBool   GCFG_HCL_HNIC_STAGING_HUGE_PAGES;
+extern GlobalConfBool   GCFG_HCL_HNIC_ADAPTIVE_CONGESTION_WINDOW;
+extern GlobalConfUint64 GCFG_HCL_HNIC_CONGESTION_WINDOW_MAX;
+extern GlobalConfUint64 GCFG_HCL_HNIC_CONGESTION_TARGET_DELAY_PERCENT;
+extern GlobalConfUint64 GCFG_HCL_HNIC_CONGESTION_MAX_STALL_USEC;
 extern GlobalConfBool   GCFG_HCL_ENABLE_G3_SR_AGG;
 extern GlobalConfBool   GCFG_ENABLE_HNIC_MICRO_STREAMS;
 extern GlobalConfBool   GCFG_HCL_REDUCE_NON_PEER_QPS;
@@ -95,7 +124,9 @@ extern GlobalConfBool   GCFG_HCCL_GET_MACS_FROM_DRIVER;
 extern GlobalConfBool   GCFG_HCL_ENABLE_HLCP;
 extern GlobalConfUint64 GCFG_HCL_HLCP_CLIENT_IO_THREADS;
 extern GlobalConfUint64 GCFG_HCL_HLCP_SERVER_IO_THREADS;
+extern GlobalConfBool   GCFG_HCL_HLCP_IO_URING;
 extern GlobalConfUint64 GCFG_HCL_HLCP_SERVER_SEND_THREAD_RANKS;
+extern GlobalConfUint64 GCFG_HCL_COORDINATOR_SEND_THREADS;
 extern GlobalConfUint64 GCFG_HCL_HLCP_OPS_TIMEOUT;
 extern GlobalConfBool   GCFG_HCL_SINGLE_QP_PER_SET;
 extern GlobalConfBool   GCFG_HCL_PROFILER_DEBUG_MODE;
@@ -147,6 +147,7 @@ struct RankInfoHeader
     int              hostnameLength                = strlen("UNKNOWN");
     char             hostname[HOSTNAME_MAX_LENGTH] = "UNKNOWN";
     sockaddr_storage caddr                         = {0};  // address of coordinator (ip + port)
+    uint64_t         unhealthyScaleOutPorts        = 0;    // by scale-out index, see HCL_SCALE_OUT_PORT_HEALTH_CHECK
 };
 
 /**
@@ -44,11 +44,16 @@ void* alloc_and_map_to_device(size_t    length,
                               off_t     offset)
 {
     void* hostAddr = alloc_mem_to_be_mapped_to_device(length, addr, prot, flags, fd, offset);
+    map_host_mem_to_device(hostAddr, length, deviceHandle, deviceFd);
+    return hostAddr;
+}
+
+void map_host_mem_to_device(void* hostAddr, size_t length, uint64_t& deviceHandle, int deviceFd)
+{
     VERIFY(deviceHandle = hlthunk_host_memory_map(deviceFd, hostAddr, 0, length),
            "hostAddr=0x{:x}, length={}",
            (uint64_t)hostAddr,
            length);
-    return hostAddr;
 }
 
 void free_mem_mapped_to_device(void* hostAddr, int length, uint64_t deviceHandle, int fd)
@@ -546,6 +546,8 @@ inline unsigned dataTypeSizeInBytes(hcclDataType_t type, bool packed = false)
     {
         case hcclInt8:
         case hcclUint8:
+        case hcclFp8E4M3:
+        case hcclFp8E5M2:
             return 1;
 
         case hcclFloat16:
@@ -769,6 +771,9 @@ void* alloc_and_map_to_device(size_t    length,
                               int       fd     = -1,
                               off_t     offset = 0);
 
+// Map memory allocated by the caller, e.g. after binding it to a NUMA node and before it is first touched
+void map_host_mem_to_device(void* hostAddr, size_t length, uint64_t& deviceHandle, int deviceFd);
+
 void free_mem_mapped_to_device(void* hostAddr, int length, uint64_t deviceHandle = 0, int fd = -1);
 
 extern const char* HCL_VERSION_HEAD;
@@ -71,19 +71,47 @@ std::string events_to_str(uint32_t events)
     return result;
 }
 
-bool asio_t::setup()
+// io_uring queue sizes. armed polls do not occupy the queues, so they only bound the batches, not the connections
+constexpr uint32_t URING_SQ_ENTRIES = 1024;
+constexpr uint32_t URING_CQ_ENTRIES = 4096;
+
+// completions handled by a worker per wait
+constexpr uint32_t URING_MAX_CQES = 32;
+
+// asio_t whose worker runs on this thread
+static thread_local const asio_t* worker_asio = nullptr;
+
+bool asio_t::setup(bool io_uring)
 {
-    epoll_fd_ = epoll_create1(0);
-    if (epoll_fd_ == -1)
+    if (io_uring)
     {
-        return false;
+        uring_ = std::make_unique<uring_t>();
+        if (!uring_->setup(URING_SQ_ENTRIES, URING_CQ_ENTRIES))
+        {
+            HLCP_WRN("io_uring is not available, using epoll");
+            uring_.reset();
+        }
     }
 
-    HLCP_LOG("epoll_fd:{} {}", epoll_fd_, this);
+    if (!uring_)
+    {
+        epoll_fd_ = epoll_create1(0);
+        if (epoll_fd_ == -1)
+        {
+            return false;
+        }
+
+        HLCP_LOG("epoll_fd:{} {}", epoll_fd_, this);
+    }
 
     // create pipe to control thread loop (now for exit only)
     RET_ON_ERR(pipe(control_));
 
+    if (uring_)
+    {
+        return arm_monitor(*this);
+    }
+
     // Add the read end of the pipe to the epoll set
     epoll_event event = {};
 
@@ -93,9 +121,9 @@ bool asio_t::setup()
     return epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, control_[0], &event) != -1;
 }
 
-bool asio_t::start(uint32_t io_threads)
+bool asio_t::start(uint32_t io_threads, bool io_uring)
 {
-    RET_ON_FALSE(setup());
+    RET_ON_FALSE(setup(io_uring));
 
     add_workers(io_threads);
 
@@ -113,7 +141,7 @@ bool asio_t::add_workers(uint32_t io_threads)
 
     FOR_I(io_threads)
     {
-        std::thread(&asio_t::epoll_thread, this).detach();
+        std::thread(uring_ ? &asio_t::uring_thread : &asio_t::epoll_thread, this).detach();
     }
 
     return true;
@@ -147,10 +175,18 @@ bool asio_t::close()
         }
     }
 
-    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, control_[0], nullptr);
+    if (uring_)
+    {
+        uring_.reset();
+        polls_.clear();
+    }
+    else
+    {
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, control_[0], nullptr);
+        ::close(epoll_fd_);
+    }
 
     ::close(control_[1]);  // Close the write end of the pipe
-    ::close(epoll_fd_);
     ::close(control_[0]);  // Close the read end of the pipe
 
     control_[0] = control_[1] = epoll_fd_ = -1;
@@ -165,6 +201,11 @@ bool asio_t::remove(asio_client_t& ioc)
     HLCP_LOG("epoll_fd:{}, fd:{}", epoll_fd_, ioc.io_fd());
     ioc.asio = nullptr;
 
+    if (uring_)
+    {
+        return uring_remove(ioc);
+    }
+
     epoll_event event = {};
 
     return epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, ioc, &event) != -1;
@@ -197,6 +238,11 @@ bool asio_t::arm_monitor(asio_client_t& ioc)
     if (ioc.mode_[armed])
         return true;
 
+    if (uring_)
+    {
+        return uring_arm(ioc);
+    }
+
     int op = op_mode(ioc);
 
     epoll_event event = {};
@@ -263,3 +309,130 @@ void asio_t::epoll_thread()
 
     running_--;
 }
+
+// =======================================================================
+
+bool asio_t::uring_arm(asio_client_t& ioc)
+{
+    op_mode(ioc);
+
+    uint64_t poll_id;
+    {
+        std::lock_guard<std::mutex> lock(polls_mtx_);
+
+        poll_id         = ++next_poll_id_;
+        polls_[poll_id] = &ioc;
+        ioc.poll_id_    = poll_id;
+    }
+
+    // poll requests are one-shot by nature, and like a re-armed one-shot epoll they report a state that is already set
+    const uint32_t events = ioc.events() & ~(EPOLLONESHOT | EPOLLET);
+
+    HLCP_LOG("[{}], poll:{}. fd:{}  [{}]", (void*)ioc, poll_id, ioc.io_fd(), events_to_str(events));
+
+    ioc.mode_[armed] = true;
+
+    if (!uring_->poll_add(ioc, events, poll_id))
+    {
+        std::lock_guard<std::mutex> lock(polls_mtx_);
+
+        polls_.erase(poll_id);
+        ioc.mode_[armed] = false;
+        return false;
+    }
+
+    // a worker submits the poll with its next wait (batched with the other polls armed by its callbacks). other
+    // threads must submit now, since the workers may be blocked waiting.
+    return (worker_asio == this) || uring_->submit();
+}
+
+bool asio_t::uring_remove(asio_client_t& ioc)
+{
+    {
+        std::lock_guard<std::mutex> lock(polls_mtx_);
+
+        if (polls_.erase(ioc.poll_id_) == 0)
+        {
+            return true;  // not armed
+        }
+    }
+
+    ioc.mode_[armed] = false;
+
+    RET_ON_FALSE(uring_->poll_remove(ioc.poll_id_));
+
+    return (worker_asio == this) || uring_->submit();
+}
+
+void asio_t::uring_thread()
+{
+    HLCP_LOG("worker");
+
+    uring_t::cqe_t cqes[URING_MAX_CQES];
+    bool           stop = false;
+
+    worker_asio = this;
+    running_++;
+
+    while (!stop)
+    {
+        const int count = uring_->wait(cqes, URING_MAX_CQES);
+        if (count == -1)
+        {
+            break;
+        }
+
+        FOR_I((uint32_t)count)
+        {
+            const uring_t::cqe_t& cqe = cqes[i];
+
+            if (cqe.user_data == URING_IGNORE)
+            {
+                continue;
+            }
+
+            asio_client_t* client = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(polls_mtx_);
+
+                auto it = polls_.find(cqe.user_data);
+                if (it == polls_.end())
+                {
+                    continue;  // removed (cancelled) while pending
+                }
+
+                client = it->second;
+                polls_.erase(it);
+            }
+
+            asio_client_t& ioc = *client;
+
+            ioc.mode_[armed] = false;
+
+            // poll result is the ready events mask, or -errno if the poll failed
+            const uint32_t events = cqe.res < 0 ? EPOLLERR : (uint32_t)cqe.res;
+
+            HLCP_LOG("[{}] fd:{} events:{}", (void*)ioc, ioc.io_fd(), events_to_str(events));
+
+            int rc = ioc.io_event(events);
+            switch (rc)
+            {
+                case IO_REARM:
+                    arm_monitor(ioc);
+                    break;
+
+                case IO_EXIT:  // exit loop
+                    // the control pipe is left readable, arm it again to stop the next worker
+                    arm_monitor(ioc);
+                    stop = true;
+                    break;
+            }
+        }
+    }
+
+    // nothing submits what this worker queued after its last wait
+    uring_->submit();
+
+    worker_asio = nullptr;
+    running_--;
+}
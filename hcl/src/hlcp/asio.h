@@ -4,10 +4,14 @@
 #include <deque>
 #include <thread>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <sys/epoll.h>
 
 #include "hlcp_inc.h"
+#include "uring.h"
 
 //
 // async IO
@@ -21,6 +25,9 @@
 // f.e. IO client is a tcp socket and we want to receive data, so the event of interest is "IN", and we register it with
 // the server. when data is arrived, thread is awoken and we shall successfully read() data from the socket.
 //
+// events are monitored with epoll, or optionally with io_uring one-shot polls (see uring_t). the backend is chosen
+// when the server starts, io_uring falls back to epoll if the kernel does not provide it.
+//
 
 class asio_t;
 
@@ -37,6 +44,7 @@ class asio_client_t
 protected:
     asio_t* asio = nullptr;
     bits_t mode_ = 0;
+    uint64_t poll_id_ = 0; // io_uring: user_data of the pending poll
 
 public:
     asio_client_t() = default;
@@ -72,7 +80,7 @@ public:
     asio_t() : running_(0) {}
     virtual ~asio_t() { close(); }
 
-    bool start(uint32_t io_threads);
+    bool start(uint32_t io_threads, bool io_uring = false);
     bool add_workers(uint32_t io_threads);
     bool stop();
 
@@ -82,19 +90,31 @@ public:
 private:
     int op_mode(asio_client_t& ioc);
 
+    bool uring_arm(asio_client_t& ioc);
+    bool uring_remove(asio_client_t& ioc);
+    void uring_thread();
+
 private:  // asio_client_t for control pipe
     virtual int      io_event(uint32_t events) override;
     virtual int      io_fd() const override { return control_[0]; };
     virtual uint32_t events() const override { return EPOLLIN; };
 
 private:
-    bool      setup();
+    bool      setup(bool io_uring);
     bool      close();
     void      epoll_thread();
     counter_t running_;
 
     int epoll_fd_ = -1;
 
+    // io_uring backend, epoll is used when not set
+    std::unique_ptr<uring_t> uring_;
+
+    // armed clients by poll id. a poll that completes after its client was removed is not found and is dropped.
+    std::mutex                                   polls_mtx_;
+    std::unordered_map<uint64_t, asio_client_t*> polls_;
+    uint64_t                                     next_poll_id_ = URING_IGNORE;
+
     // control pipe [read, write]
     int control_[2] = {-1, -1};
 };
@@ -1,9 +1,9 @@
 #include "coordinator.h"
 #include <string.h>
 
-bool coordinator_t::start(uint32_t io_threads, const sockaddr_t& addr)
+bool coordinator_t::start(uint32_t io_threads, const sockaddr_t& addr, bool io_uring)
 {
-    RET_ON_FALSE(asio_.start(io_threads));
+    RET_ON_FALSE(asio_.start(io_threads, io_uring));
     RET_ON_FALSE(srv_.listen(addr));
     RET_ON_FALSE(asio_.arm_monitor(srv_));
 
@@ -1,4 +1,7 @@
 #pragma once
+#include <condition_variable>
+#include <mutex>
+
 #include "acceptor.h"
 #include "hlcp.h"
 
@@ -29,6 +32,18 @@ protected:
     asio_t     asio_;
     acceptor_t srv_;
 
+    // wakes up wait_event_condition() waiters after protocol state was updated
+    std::mutex              event_mtx_;
+    std::condition_variable event_cv_;
+
+    void notify_event()
+    {
+        {
+            std::lock_guard<std::mutex> lock(event_mtx_);
+        }
+        event_cv_.notify_all();
+    }
+
 protected:  // socket_op_notify_t
     virtual void on_error(socket_base_t& s) override;
     virtual void on_accept(socket_base_t& s, int new_socket_fd) override;  // srv new connection
@@ -46,7 +61,7 @@ public:
 
     const acceptor_t* operator->() { return &srv_; }
 
-    bool start(uint32_t io_threads, const sockaddr_t& addr = sockaddr_t());
+    bool start(uint32_t io_threads, const sockaddr_t& addr = sockaddr_t(), bool io_uring = false);
 
     bool stop();
 };
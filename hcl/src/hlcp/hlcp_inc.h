@@ -21,6 +21,24 @@
         }                                                                                                              \
     } while (false)
 
+// coordinator_t only: wait until cond is met, woken by notify_event() (wait_sleep is only a fallback period).
+// cond is evaluated under the event lock, so a notification cannot be lost between the check and the wait
+#define wait_event_condition(cond, timeout_sec)                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        set_expired((timeout_sec));                                                                                    \
+        std::unique_lock<std::mutex> __lock__(event_mtx_);                                                             \
+        while (!(cond))                                                                                                \
+        {                                                                                                              \
+            if (is_expired())                                                                                          \
+            {                                                                                                          \
+                HLCP_ERR("timeout ({}) expired while waiting for: " #cond, timeout_sec);                               \
+                return false;                                                                                          \
+            }                                                                                                          \
+            event_cv_.wait_for(__lock__, std::chrono::microseconds(wait_sleep));                                       \
+        }                                                                                                              \
+    } while (false)
+
 #define RET_ON_FALSE(func)                                                                                             \
     if (!func) return false
 #define RET_ON_ERR(func)                                                                                               \
@@ -0,0 +1,214 @@
+#include "uring.h"
+
+#include <algorithm>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+//
+// ring memory is shared with the kernel: the kernel consumes the submission queue up to sq tail (which we publish
+// with release semantics) and produces the completion queue up to cq tail (which we read with acquire semantics).
+//
+
+bool uring_t::setup(uint32_t sq_entries, uint32_t cq_entries)
+{
+    io_uring_params params = {};
+
+    params.flags      = IORING_SETUP_CQSIZE;
+    params.cq_entries = cq_entries;
+
+    ring_fd_ = (int)syscall(__NR_io_uring_setup, sq_entries, &params);
+    if (ring_fd_ == -1)
+    {
+        HLCP_DBG("io_uring_setup() failed: ({}) {}", errno, strerror(errno));
+        return false;
+    }
+
+    // single mmap for both queues (5.4) and completions are never dropped when the CQ overflows (5.5)
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_NODROP))
+    {
+        HLCP_DBG("io_uring features {:#x} are not sufficient", params.features);
+        close();
+        return false;
+    }
+
+    ring_size_ = std::max(params.sq_off.array + params.sq_entries * sizeof(uint32_t),
+                          params.cq_off.cqes + params.cq_entries * sizeof(cqe_t));
+
+    ring_ = mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    if (ring_ == MAP_FAILED)
+    {
+        ring_ = nullptr;
+        HLCP_ERR("io_uring rings mmap() failed: ({}) {}", errno, strerror(errno));
+        close();
+        return false;
+    }
+
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+
+    void* sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        HLCP_ERR("io_uring sqes mmap() failed: ({}) {}", errno, strerror(errno));
+        close();
+        return false;
+    }
+    sqes_ = (io_uring_sqe*)sqes;
+
+    uint8_t* ring = (uint8_t*)ring_;
+
+    sq_head_  = (uint32_t*)(ring + params.sq_off.head);
+    sq_tail_  = (uint32_t*)(ring + params.sq_off.tail);
+    sq_array_ = (uint32_t*)(ring + params.sq_off.array);
+    sq_mask_  = *(uint32_t*)(ring + params.sq_off.ring_mask);
+    sq_size_  = params.sq_entries;
+
+    cq_head_ = (uint32_t*)(ring + params.cq_off.head);
+    cq_tail_ = (uint32_t*)(ring + params.cq_off.tail);
+    cqes_    = (cqe_t*)(ring + params.cq_off.cqes);
+    cq_mask_ = *(uint32_t*)(ring + params.cq_off.ring_mask);
+
+    HLCP_LOG("ring_fd:{} sq:{} cq:{}", ring_fd_, params.sq_entries, params.cq_entries);
+
+    return true;
+}
+
+void uring_t::close()
+{
+    if (sqes_)
+    {
+        munmap(sqes_, sqes_size_);
+    }
+
+    if (ring_)
+    {
+        munmap(ring_, ring_size_);
+    }
+
+    if (ring_fd_ != -1)
+    {
+        ::close(ring_fd_);
+    }
+
+    sqes_    = nullptr;
+    ring_    = nullptr;
+    ring_fd_ = -1;
+}
+
+int uring_t::enter(uint32_t to_submit, uint32_t min_complete, uint32_t flags)
+{
+    int rc;
+
+    do
+    {
+        rc = (int)syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete, flags, nullptr, 0);
+    } while ((rc == -1) && (errno == EINTR));
+
+    return rc;
+}
+
+uint32_t uring_t::to_submit() const
+{
+    return __atomic_load_n(sq_tail_, __ATOMIC_ACQUIRE) - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+}
+
+bool uring_t::queue(uint8_t opcode, int fd, uint64_t addr, uint32_t events, uint64_t user_data)
+{
+    std::lock_guard<std::mutex> lock(sq_mtx_);
+
+    const uint32_t tail = *sq_tail_;  // written by us only
+
+    if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == sq_size_)
+    {
+        // queue is full, hand the queued entries to the kernel to make room
+        if ((enter(sq_size_, 0, 0) == -1) || (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == sq_size_))
+        {
+            HLCP_ERR("io_uring submission queue is full: ({}) {}", errno, strerror(errno));
+            return false;
+        }
+    }
+
+    const uint32_t index = tail & sq_mask_;
+    io_uring_sqe&  sqe   = sqes_[index];
+
+    memset(&sqe, 0, sizeof(sqe));
+
+    sqe.opcode        = opcode;
+    sqe.fd            = fd;
+    sqe.addr          = addr;
+    sqe.poll32_events = events;  // little endian only, the low 16 bits are the legacy poll_events
+    sqe.user_data     = user_data;
+
+    sq_array_[index] = index;
+
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+bool uring_t::poll_add(int fd, uint32_t events, uint64_t user_data)
+{
+    return queue(IORING_OP_POLL_ADD, fd, 0, events, user_data);
+}
+
+bool uring_t::poll_remove(uint64_t user_data)
+{
+    return queue(IORING_OP_POLL_REMOVE, -1, user_data, 0, URING_IGNORE);
+}
+
+bool uring_t::submit()
+{
+    const uint32_t count = to_submit();
+
+    if (count == 0)
+    {
+        return true;
+    }
+
+    RET_ON_ERR(enter(count, 0, 0));
+
+    return true;
+}
+
+uint32_t uring_t::reap(cqe_t* cqes, uint32_t max_cqes)
+{
+    std::lock_guard<std::mutex> lock(cq_mtx_);
+
+    uint32_t       head  = *cq_head_;
+    const uint32_t tail  = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    uint32_t       count = 0;
+
+    while ((head != tail) && (count < max_cqes))
+    {
+        cqes[count++] = cqes_[head & cq_mask_];
+        head++;
+    }
+
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+int uring_t::wait(cqe_t* cqes, uint32_t max_cqes)
+{
+    while (true)
+    {
+        const uint32_t count = reap(cqes, max_cqes);
+        if (count > 0)
+        {
+            return count;
+        }
+
+        //
+        // several threads may wait on the ring, all of them are woken by a completion and only one gets it,
+        // the others find the queue empty and wait again.
+        // EBUSY / EAGAIN: the kernel could not submit since completions are pending, reap them first.
+        //
+        if ((enter(to_submit(), 1, IORING_ENTER_GETEVENTS) == -1) && (errno != EBUSY) && (errno != EAGAIN))
+        {
+            HLCP_ERR("io_uring_enter() failed: ({}) {}", errno, strerror(errno));
+            return -1;
+        }
+    }
+}
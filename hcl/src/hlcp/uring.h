@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+#include <linux/io_uring.h>
+
+#include "hlcp_inc.h"
+
+//
+// minimal io_uring wrapper used by asio_t as an alternative to epoll.
+//
+// only one-shot poll requests are used, so the readiness model of asio_client_t is kept as is: a poll completion is
+// the equivalent of an EPOLLONESHOT event. the gain over epoll is in the syscall count - arming a client only queues
+// a submission entry, queued entries are submitted by the same io_uring_enter() that waits for completions, and one
+// wait returns a batch of completions.
+//
+// submission and completion queues may be used by several threads, each side is guarded by its own lock.
+//
+
+class uring_t
+{
+public:
+    using cqe_t = io_uring_cqe;
+
+    uring_t() = default;
+    uring_t(const uring_t& o) = delete;
+    ~uring_t() { close(); }
+
+    // false if io_uring is not available (old kernel, disabled by seccomp / sysctl ...)
+    bool setup(uint32_t sq_entries, uint32_t cq_entries);
+    void close();
+
+    // queue a one-shot poll / cancel a queued or pending poll, submitted with the next submit() or wait()
+    bool poll_add(int fd, uint32_t events, uint64_t user_data);
+    bool poll_remove(uint64_t user_data);
+
+    bool submit();
+
+    // submit queued entries and wait for at least one completion
+    // return value: number of completions copied to cqes, -1 on error
+    int wait(cqe_t* cqes, uint32_t max_cqes);
+
+private:
+    bool     queue(uint8_t opcode, int fd, uint64_t addr, uint32_t events, uint64_t user_data);
+    uint32_t reap(cqe_t* cqes, uint32_t max_cqes);
+    uint32_t to_submit() const;
+    int      enter(uint32_t to_submit, uint32_t min_complete, uint32_t flags);
+
+    int ring_fd_ = -1;
+
+    void*  ring_      = nullptr;
+    size_t ring_size_ = 0;
+
+    io_uring_sqe* sqes_      = nullptr;
+    size_t        sqes_size_ = 0;
+
+    // submission queue
+    std::mutex sq_mtx_;
+    uint32_t*  sq_head_  = nullptr;
+    uint32_t*  sq_tail_  = nullptr;
+    uint32_t*  sq_array_ = nullptr;
+    uint32_t   sq_mask_  = 0;
+    uint32_t   sq_size_  = 0;
+
+    // completion queue
+    std::mutex cq_mtx_;
+    uint32_t*  cq_head_ = nullptr;
+    uint32_t*  cq_tail_ = nullptr;
+    cqe_t*     cqes_    = nullptr;
+    uint32_t   cq_mask_ = 0;
+};
+
+// user_data of requests whose completion is of no interest (poll_remove)
+constexpr uint64_t URING_IGNORE = 0;
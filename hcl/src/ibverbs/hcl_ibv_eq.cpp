@@ -257,6 +257,11 @@ bool hcl_ibverbs_t::parse_ib_eqe(ibv_async_event* event)
         case IBV_EVENT_PORT_ERR:
             triggerDFA = false;
             INF_IBV("{}, NIC({})", err2str[event->event_type], port2nic_[event->element.port_num]);
+            if (device_ != nullptr)
+            {
+                device_->onPortStateChange(port2nic_[event->element.port_num],
+                                           event->event_type == IBV_EVENT_PORT_ACTIVE);
+            }
             break;
 
         case IBV_EVENT_SM_CHANGE:
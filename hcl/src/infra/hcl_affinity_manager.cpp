@@ -6,6 +6,7 @@
 #include <unistd.h>           // for getpid
 #include <cstdint>            // for uint32_t, uint8_t
 #include <vector>             // for vector
+#include <algorithm>          // for find
 #include <cerrno>             // for errno
 #include "hcl_global_conf.h"  // for GCFG_USE_CPU_AFFINITY
 #include "hcl_log_manager.h"  // for LOG_*
@@ -84,13 +85,27 @@ void HclThread::setCpuAffinity()
 {
     VERIFY(m_threadType <= eHCLNormalThread);
 
-    if (!g_affinityManager.m_shouldPinThreads) return;
+    if (!g_affinityManager.m_shouldPinThreads)
+    {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (!m_preferredCpus.empty() && sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+        {
+            setPreferredCpuAffinity(allowed);
+        }
+        return;
+    }
 
     if (m_threadType != eHCLNormalThread)
     {
         VERIFY(!g_affinityManager.m_priorityCpu.empty(),
                "tried to create priority thread but there aren't any available!");
         uint32_t cpuId = g_affinityManager.m_priorityCpu[m_threadType];
+        if (!m_preferredCpus.empty() &&
+            std::find(m_preferredCpus.begin(), m_preferredCpus.end(), cpuId) == m_preferredCpus.end())
+        {
+            LOG_HCL_WARN(HCL, "Priority CPU {} is not one of the thread's preferred CPUs", cpuId);
+        }
 
         LOG_HCL_INFO(HCL,
                      "Setting CPU {} for priority thread {}",
@@ -101,7 +116,7 @@ void HclThread::setCpuAffinity()
         CPU_SET(cpuId, &set);
         sched_setaffinity(0, sizeof(set), &set);
     }
-    else
+    else if (!setPreferredCpuAffinity(g_affinityManager.m_normalCpuMask))
     {
         LOG_HCL_INFO(HCL,
                      "Setting thread {} to run on remaining threads...",
@@ -109,3 +124,30 @@ void HclThread::setCpuAffinity()
         sched_setaffinity(0, sizeof(g_affinityManager.m_normalCpuMask), &g_affinityManager.m_normalCpuMask);
     }
 }
+
+bool HclThread::setPreferredCpuAffinity(const cpu_set_t& allowed)
+{
+    if (m_preferredCpus.empty()) return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const uint32_t cpuId : m_preferredCpus)
+    {
+        if (cpuId < CPU_SETSIZE && CPU_ISSET(cpuId, &allowed))
+        {
+            CPU_SET(cpuId, &set);
+        }
+    }
+
+    if (CPU_COUNT(&set) == 0)
+    {
+        LOG_HCL_WARN(HCL, "None of the thread's preferred CPUs is available to the process, keeping its affinity");
+        return false;
+    }
+
+    LOG_HCL_INFO(HCL,
+                 "Setting thread {} to run on {} preferred CPUs",
+                 std::hash<std::thread::id> {}(std::this_thread::get_id()),
+                 CPU_COUNT(&set));
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
@@ -3,9 +3,11 @@
 #include <thread>
 #include <functional>
 #include <pthread.h>  // for pthread_self
+#include <sched.h>    // for cpu_set_t
 #include <cstdint>    // for uint32_t, uint64_t, uint8_t
 #include <string>     // for string, allocator
 #include <utility>    // for forward
+#include <vector>     // for vector
 #include "hcl_utils.h"
 
 enum HclThreadType
@@ -48,6 +50,14 @@ public:
         m_thread                   = std::thread(&HclThread::run, this, func);
     }
 
+    /**
+     * Restrict the thread to the given CPUs, e.g. the CPUs of the NUMA node of the device it serves.
+     * A thread pinned to a priority CPU keeps it. Must be called before initialize().
+     *
+     * @param cpus OS indexes of the preferred CPUs
+     */
+    void setPreferredCpus(const std::vector<uint32_t>& cpus) { m_preferredCpus = cpus; }
+
     HclThread(HclThread& other)             = delete;
     HclThread(HclThread&& other)            = delete;
     HclThread& operator=(HclThread& other)  = delete;
@@ -66,9 +76,12 @@ private:
         func();
     }
     void setCpuAffinity();
+    bool setPreferredCpuAffinity(const cpu_set_t& allowed);
 
     uint32_t      m_myDevice = 0;
     std::string   m_hostname = "";
     std::thread   m_thread;
     HclThreadType m_threadType = eHCLNormalThread;
+
+    std::vector<uint32_t> m_preferredCpus;
 };
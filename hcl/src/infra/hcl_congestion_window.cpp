@@ -0,0 +1,119 @@
+#include "infra/hcl_congestion_window.h"
+
+#include <algorithm>          // for min, max, clamp
+#include <chrono>             // for steady_clock
+#include "hcl_log_manager.h"  // for LOG_*
+
+// Latencies of messages up to this size are compared as is, larger messages are scaled down to it
+static constexpr uint64_t NORMALIZED_MESSAGE_SIZE = 64 * 1024;
+
+// The base delay is re-learned every that many completions, so it can follow route changes
+static constexpr uint64_t BASE_DELAY_PERIOD = 4096;
+
+// Multiplicative decrease is proportional to the excess delay, and never more than half of the window
+static constexpr double DECREASE_GAIN = 0.8;
+static constexpr double MAX_DECREASE  = 0.5;
+
+uint64_t HclCongestionWindow::nowNsec()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void HclCongestionWindow::init(uint32_t initialWindow,
+                               uint32_t maxWindow,
+                               uint32_t targetDelayPercent,
+                               uint64_t maxStallUsec)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxWindow          = std::max(maxWindow, 1u);
+    m_windowFp           = std::clamp(initialWindow, 1u, m_maxWindow);
+    m_targetDelayPercent = targetDelayPercent;
+    m_maxStallNsec       = maxStallUsec * 1000;
+    m_window.store((uint32_t)m_windowFp, std::memory_order_relaxed);
+}
+
+bool HclCongestionWindow::tryAcquire()
+{
+    uint32_t inFlight = m_inFlight.load(std::memory_order_relaxed);
+    while (inFlight < m_window.load(std::memory_order_relaxed))
+    {
+        if (m_inFlight.compare_exchange_weak(inFlight, inFlight + 1, std::memory_order_relaxed))
+        {
+            m_blockedSinceNsec.store(0, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Sends of different streams may depend on each other through the peers, so the window only delays a send for a
+    // bounded time and never blocks it for good
+    const uint64_t now          = nowNsec();
+    uint64_t       blockedSince = m_blockedSinceNsec.load(std::memory_order_relaxed);
+    if (blockedSince == 0)
+    {
+        m_blockedSinceNsec.compare_exchange_strong(blockedSince, now, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (now > blockedSince && now - blockedSince >= m_maxStallNsec &&
+        m_blockedSinceNsec.compare_exchange_strong(blockedSince, 0, std::memory_order_relaxed))
+    {
+        m_inFlight.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+void HclCongestionWindow::release()
+{
+    m_inFlight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void HclCongestionWindow::onCompletion(uint64_t latencyNsec, uint64_t sizeBytes)
+{
+    release();
+
+    const uint64_t delay =
+        sizeBytes > NORMALIZED_MESSAGE_SIZE ? latencyNsec * NORMALIZED_MESSAGE_SIZE / sizeBytes : latencyNsec;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_baseDelayNsec      = std::min(m_baseDelayNsec, delay);
+    m_periodMinDelayNsec = std::min(m_periodMinDelayNsec, delay);
+    if (++m_periodSamples == BASE_DELAY_PERIOD)
+    {
+        m_baseDelayNsec      = m_periodMinDelayNsec;
+        m_periodMinDelayNsec = UINT64_MAX;
+        m_periodSamples      = 0;
+    }
+
+    const uint64_t targetDelay = m_baseDelayNsec + m_baseDelayNsec * m_targetDelayPercent / 100;
+    m_completedSinceDecrease++;
+
+    if (delay <= targetDelay)
+    {
+        // Additive increase, one more send per window of completions
+        m_windowFp += 1.0 / m_windowFp;
+    }
+    else if (m_completedSinceDecrease >= m_windowFp)
+    {
+        const double excess = (double)(delay - targetDelay) / delay;
+        m_windowFp *= std::max(1.0 - DECREASE_GAIN * excess, 1.0 - MAX_DECREASE);
+        m_completedSinceDecrease = 0;
+    }
+
+    m_windowFp = std::clamp(m_windowFp, 1.0, (double)m_maxWindow);
+
+    const uint32_t window = (uint32_t)m_windowFp;
+    if (window != m_window.load(std::memory_order_relaxed))
+    {
+        LOG_TRACE(HCL_OFI,
+                  "Congestion window {} -> {}, delay={}ns, target={}ns",
+                  m_window.load(std::memory_order_relaxed),
+                  window,
+                  delay,
+                  targetDelay);
+        m_window.store(window, std::memory_order_relaxed);
+    }
+}
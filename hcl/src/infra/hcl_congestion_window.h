@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>   // for atomic
+#include <cstdint>  // for uint32_t, uint64_t
+#include <mutex>    // for mutex
+
+/**
+ * Delay based congestion window for one scale-out path, i.e. the number of sends allowed in flight on it.
+ *
+ * Every completed send reports its latency. The latency is normalized by the message size and compared to the lowest
+ * normalized latency seen on the path (the base delay). While the path stays within the target delay the window grows
+ * by one send per window of completions, and once queuing pushes it above the target the window shrinks
+ * multiplicatively, at most once per window of completions.
+ *
+ * tryAcquire() is called by the senders and onCompletion() by the threads reaping the completions, possibly from
+ * several threads concurrently.
+ */
+class HclCongestionWindow
+{
+public:
+    HclCongestionWindow() = default;
+
+    HclCongestionWindow(const HclCongestionWindow&)            = delete;
+    HclCongestionWindow& operator=(const HclCongestionWindow&) = delete;
+
+    /**
+     * @param initialWindow window to start from, clamped to [1, maxWindow]
+     * @param maxWindow largest allowed window
+     * @param targetDelayPercent latency above the base delay, in percent of it, that is still considered uncongested
+     * @param maxStallUsec longest time the window may block senders before one send is let through anyway
+     */
+    void init(uint32_t initialWindow, uint32_t maxWindow, uint32_t targetDelayPercent, uint64_t maxStallUsec);
+
+    /**
+     * Reserve room for a send. Returns false if the window is full and the send should be retried later.
+     */
+    bool tryAcquire();
+
+    /**
+     * Return a reservation of a send that was not posted.
+     */
+    void release();
+
+    /**
+     * Return the reservation of a completed send and adapt the window to its latency.
+     */
+    void onCompletion(uint64_t latencyNsec, uint64_t sizeBytes);
+
+    uint32_t getWindow() const { return m_window.load(std::memory_order_relaxed); }
+
+    // Clock the send and completion times are taken from
+    static uint64_t nowNsec();
+
+private:
+    std::atomic<uint32_t> m_inFlight {0};
+    std::atomic<uint32_t> m_window {1};
+    std::atomic<uint64_t> m_blockedSinceNsec {0};
+
+    // Window state, updated under m_mutex by the completion path
+    std::mutex m_mutex;
+    double     m_windowFp               = 1;
+    uint32_t   m_maxWindow              = 1;
+    uint32_t   m_targetDelayPercent     = 0;
+    uint64_t   m_maxStallNsec           = 0;
+    uint64_t   m_baseDelayNsec          = UINT64_MAX;
+    uint64_t   m_periodMinDelayNsec     = UINT64_MAX;
+    uint64_t   m_periodSamples          = 0;
+    uint64_t   m_completedSinceDecrease = 0;
+};
@@ -0,0 +1,507 @@
+#include "infra/hcl_latency_stats.h"
+
+#include <algorithm>          // for min, max, find
+#include <chrono>             // for steady_clock, microseconds
+#include <utility>            // for pair
+#include "hcl_types.h"        // for operator<< of HCL_CollectiveOp
+#include "hcl_utils.h"        // for VERIFY
+#include "hcl_log_manager.h"  // for LOG_*
+
+const char* toString(LatencyPhase phase)
+{
+    switch (phase)
+    {
+        case LatencyPhase::SUBMIT:
+            return "submit";
+        case LatencyPhase::SCALE_UP:
+            return "host scale-up";
+        case LatencyPhase::SCALE_OUT:
+            return "host scale-out";
+        case LatencyPhase::REDUCTION:
+            return "host reduction";
+        case LatencyPhase::DEVICE_WAIT:
+            return "device wait";
+        case LatencyPhase::COMPLETION:
+            return "completion";
+        default:
+            return "unknown";
+    }
+}
+
+void LatencyHistogram::record(uint64_t latencyUsec)
+{
+    const unsigned bucket = latencyUsec == 0 ? 0 : 64 - __builtin_clzll(latencyUsec);
+    m_buckets[std::min(bucket, NUM_BUCKETS - 1)]++;
+    m_count++;
+    m_sumUsec += latencyUsec;
+    m_maxUsec = std::max(m_maxUsec, latencyUsec);
+}
+
+void LatencyHistogram::reset()
+{
+    *this = LatencyHistogram();
+}
+
+uint64_t LatencyHistogram::percentileUsec(unsigned percentile) const
+{
+    if (m_count == 0) return 0;
+
+    const uint64_t target = std::max<uint64_t>(1, (m_count * std::min(percentile, 100u) + 99) / 100);
+    uint64_t       seen   = 0;
+    for (unsigned bucket = 0; bucket < NUM_BUCKETS - 1; bucket++)
+    {
+        seen += m_buckets[bucket];
+        if (seen >= target)
+        {
+            return std::min(uint64_t(1) << bucket, m_maxUsec);
+        }
+    }
+
+    return m_maxUsec;
+}
+
+LatencyHistogram& LatencyHistogram::operator+=(const LatencyHistogram& other)
+{
+    for (unsigned bucket = 0; bucket < NUM_BUCKETS; bucket++)
+    {
+        m_buckets[bucket] += other.m_buckets[bucket];
+    }
+    m_count += other.m_count;
+    m_sumUsec += other.m_sumUsec;
+    m_maxUsec = std::max(m_maxUsec, other.m_maxUsec);
+
+    return *this;
+}
+
+std::string LatencyHistogram::toString() const
+{
+    return fmt::format(FMT_COMPILE("count={} mean={}us p50={}us p90={}us p99={}us max={}us"),
+                       m_count,
+                       meanUsec(),
+                       percentileUsec(50),
+                       percentileUsec(90),
+                       percentileUsec(99),
+                       m_maxUsec);
+}
+
+CollectiveLatencyStats::~CollectiveLatencyStats()
+{
+    stop();
+
+    for (unsigned op = 0; op < eHCLCollectiveLastValue; op++)
+    {
+        for (unsigned phase = 0; phase < NUM_LATENCY_PHASES; phase++)
+        {
+            const LatencyHistogram& histogram = m_histograms[op][phase];
+            if (histogram.count() == 0) continue;
+
+            LOG_INFO(HCL,
+                     "comm({}) {} {} latency: {}",
+                     m_comm,
+                     HCL_CollectiveOp(op),
+                     toString(LatencyPhase(phase)),
+                     histogram.toString());
+        }
+    }
+
+    if (m_dropped > 0)
+    {
+        LOG_WARN(HCL, "comm({}) {} latency samples dropped, too many collectives in flight", m_comm, m_dropped);
+    }
+}
+
+void CollectiveLatencyStats::start(CompletionQuery query, ReportSender sender, HCL_Rank rank, uint64_t windowSize)
+{
+    VERIFY(!m_started, "comm({}) latency stats already started", m_comm);
+
+    m_query      = std::move(query);
+    m_sender     = std::move(sender);
+    m_rank       = rank;
+    m_windowSize = windowSize;
+    m_started    = true;
+    LatencyStatsPoller::instance().add(this);
+}
+
+void CollectiveLatencyStats::stop()
+{
+    if (!m_started) return;
+
+    LatencyStatsPoller::instance().remove(this);
+
+    // Record what completed since the last poll, e.g. everything when the streams were synchronized before stopping.
+    // The collectives of a window that did not complete are not reported.
+    std::vector<LatencyReportMessage> reports;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        pollCompletions(lock);
+        m_dropped += m_pending.size();
+        m_pending.clear();
+        m_openReports.clear();
+        reports.swap(m_readyReports);
+        m_started = false;
+    }
+
+    if (m_sender)
+    {
+        for (const LatencyReportMessage& report : reports)
+        {
+            m_sender(report);
+        }
+    }
+}
+
+void CollectiveLatencyStats::onSubmit(HCL_CollectiveOp      op,
+                                      uint64_t              startNsec,
+                                      unsigned              archStreamId,
+                                      uint64_t              targetValue,
+                                      const PhaseLatencies* hostPhases)
+{
+    if (!m_started || op >= eHCLCollectiveLastValue) return;
+    if (ScopedLatencyOp::attach(*this, archStreamId, targetValue)) return;
+
+    queue({op,
+           op == eHCLNoCollective ? NO_COLLECTIVE : nextCollective(),
+           startNsec,
+           nowNsec(),
+           archStreamId,
+           targetValue,
+           hostPhases != nullptr,
+           hostPhases != nullptr ? *hostPhases : PhaseLatencies {}});
+}
+
+uint64_t CollectiveLatencyStats::nextCollective()
+{
+    return m_collectives.fetch_add(1);
+}
+
+void CollectiveLatencyStats::queue(const PendingSample& sample)
+{
+    bool wasEmpty;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.size() >= MAX_PENDING_SAMPLES)
+        {
+            m_dropped++;
+            if (sample.collective != NO_COLLECTIVE)
+            {
+                addToReport(sample.collective, LATENCY_REPORT_NO_SAMPLE);
+            }
+            return;
+        }
+        wasEmpty = m_pending.empty();
+        m_pending.push_back(sample);
+    }
+
+    // The poller polls idle stats only every idle interval
+    if (wasEmpty) LatencyStatsPoller::instance().notify();
+}
+
+bool CollectiveLatencyStats::poll()
+{
+    std::vector<LatencyReportMessage> reports;
+    bool                              pending;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        pollCompletions(lock);
+        checkStall(nowNsec());
+        reports.swap(m_readyReports);
+        pending = !m_pending.empty();
+    }
+
+    // Sent without the lock, so the API thread is never blocked on the coordinator
+    if (m_sender)
+    {
+        for (const LatencyReportMessage& report : reports)
+        {
+            m_sender(report);
+        }
+    }
+
+    return pending;
+}
+
+/**
+ * @brief record the pending samples whose streams reached their targets
+ *
+ * The device is queried without the lock, so the API thread can queue samples meanwhile. Targets of a stream complete
+ * in order, so a stream is not queried again in the same poll once one of its targets is not reached.
+ */
+void CollectiveLatencyStats::pollCompletions(std::unique_lock<std::mutex>& lock)
+{
+    std::deque<PendingSample> pending;
+    pending.swap(m_pending);
+    lock.unlock();
+
+    std::deque<PendingSample>                       remaining;
+    std::vector<std::pair<PendingSample, uint64_t>> completed;
+    std::vector<unsigned>                           blockedStreams;
+    for (const PendingSample& sample : pending)
+    {
+        const bool blocked = std::find(blockedStreams.begin(), blockedStreams.end(), sample.archStreamId) !=
+                             blockedStreams.end();
+        if (!blocked && m_query(sample.archStreamId, sample.targetValue))
+        {
+            completed.push_back({sample, nowNsec()});
+            continue;
+        }
+
+        if (!blocked) blockedStreams.push_back(sample.archStreamId);
+        remaining.push_back(sample);
+    }
+
+    lock.lock();
+    m_pending.insert(m_pending.begin(), remaining.begin(), remaining.end());
+    for (const auto& [sample, completionNsec] : completed)
+    {
+        record(sample, completionNsec);
+    }
+}
+
+void CollectiveLatencyStats::record(const PendingSample& sample, uint64_t completionNsec)
+{
+    // The device starts on a collective once it is submitted and the previous work of its stream completed
+    uint64_t&      streamIdleNsec = m_lastCompletionNsec[sample.archStreamId];
+    const uint64_t runnableNsec   = std::max(sample.submitNsec, streamIdleNsec);
+    streamIdleNsec                = completionNsec;
+
+    PhaseLatencies latenciesUsec = {};
+    for (unsigned phase = 0; phase < NUM_LATENCY_PHASES; phase++)
+    {
+        latenciesUsec[phase] = sample.hostPhases[phase] / 1000;
+    }
+    latenciesUsec[unsigned(LatencyPhase::SUBMIT)] = (sample.submitNsec - sample.startNsec) / 1000;
+    latenciesUsec[unsigned(LatencyPhase::DEVICE_WAIT)] =
+        (completionNsec - std::min(runnableNsec, completionNsec)) / 1000;
+    latenciesUsec[unsigned(LatencyPhase::COMPLETION)] = (completionNsec - sample.startNsec) / 1000;
+
+    for (unsigned phase = 0; phase < NUM_LATENCY_PHASES; phase++)
+    {
+        const bool hostSubPhase = phase == unsigned(LatencyPhase::SCALE_UP) ||
+                                  phase == unsigned(LatencyPhase::SCALE_OUT) ||
+                                  phase == unsigned(LatencyPhase::REDUCTION);
+        if (hostSubPhase && !sample.hasHostPhases) continue;
+
+        m_histograms[sample.op][phase].record(latenciesUsec[phase]);
+        m_window[phase].record(latenciesUsec[phase]);
+    }
+
+    if (sample.collective != NO_COLLECTIVE)
+    {
+        const uint64_t waitUsec = latenciesUsec[unsigned(LatencyPhase::DEVICE_WAIT)];
+        addToReport(sample.collective, std::min<uint64_t>(waitUsec, LATENCY_REPORT_NO_SAMPLE - 1));
+    }
+
+    if (m_windowSize > 0 && m_window[0].count() >= m_windowSize)
+    {
+        logWindow();
+    }
+}
+
+void CollectiveLatencyStats::addToReport(uint64_t collective, uint32_t waitUsec)
+{
+    const uint64_t window = collective / LATENCY_REPORT_COLLECTIVES;
+    OpenReport&    report = m_openReports[window];
+    if (report.filled == 0)
+    {
+        report.message.rank    = m_rank;
+        report.message.stalled = false;
+        report.message.window  = window;
+    }
+    report.message.waitUsec[collective % LATENCY_REPORT_COLLECTIVES] = waitUsec;
+
+    // Collectives on different streams may complete out of order, a window is reported once all of them completed
+    if (++report.filled == LATENCY_REPORT_COLLECTIVES)
+    {
+        report.message.submitted = m_collectives.load();
+        m_readyReports.push_back(report.message);
+        m_openReports.erase(window);
+    }
+}
+
+void CollectiveLatencyStats::checkStall(uint64_t nowNsec)
+{
+    if (m_pending.empty()) return;
+
+    const uint64_t intervalNsec = STALL_REPORT_INTERVAL_USEC * 1000;
+    const uint64_t waitingNsec  = nowNsec - std::min(nowNsec, m_pending.front().submitNsec);
+    if (waitingNsec < intervalNsec || nowNsec - m_lastStallReportNsec < intervalNsec) return;
+
+    m_lastStallReportNsec = nowNsec;
+
+    uint64_t waitingFor = m_collectives.load();
+    for (const PendingSample& sample : m_pending)
+    {
+        if (sample.collective != NO_COLLECTIVE)
+        {
+            waitingFor = sample.collective;
+            break;
+        }
+    }
+
+    LOG_WARN(HCL,
+             "comm({}) rank({}) collective #{} not completed for {}ms, {} collectives submitted",
+             m_comm,
+             m_rank,
+             waitingFor,
+             waitingNsec / 1000000,
+             m_collectives.load());
+
+    LatencyReportMessage report = {};
+    report.rank                 = m_rank;
+    report.stalled              = true;
+    report.window               = waitingFor;
+    report.submitted            = m_collectives.load();
+    m_readyReports.push_back(report);
+}
+
+void CollectiveLatencyStats::logWindow()
+{
+    for (unsigned phase = 0; phase < NUM_LATENCY_PHASES; phase++)
+    {
+        if (m_window[phase].count() == 0) continue;
+
+        LOG_INFO(HCL,
+                 "comm({}) last {} collectives {} latency: {}",
+                 m_comm,
+                 m_window[phase].count(),
+                 toString(LatencyPhase(phase)),
+                 m_window[phase].toString());
+    }
+    for (LatencyHistogram& histogram : m_window)
+    {
+        histogram.reset();
+    }
+}
+
+uint64_t CollectiveLatencyStats::nowNsec()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+LatencyStatsPoller& LatencyStatsPoller::instance()
+{
+    // Never destroyed, so a communicator that is not destroyed before exit can not terminate a joinable thread
+    static LatencyStatsPoller* poller = new LatencyStatsPoller();
+    return *poller;
+}
+
+void LatencyStatsPoller::add(CollectiveLatencyStats* stats)
+{
+    std::lock_guard<std::mutex> lifecycleLock(m_lifecycleMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.push_back(stats);
+    }
+
+    if (!m_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_stop = false;
+        }
+        m_thread = std::thread(&LatencyStatsPoller::run, this);
+    }
+}
+
+void LatencyStatsPoller::remove(CollectiveLatencyStats* stats)
+{
+    std::lock_guard<std::mutex> lifecycleLock(m_lifecycleMutex);
+    bool                        last;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.erase(std::remove(m_stats.begin(), m_stats.end(), stats), m_stats.end());
+        last = m_stats.empty();
+    }
+
+    if (last && m_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_stop = true;
+        }
+        m_cv.notify_one();
+        m_thread.join();
+    }
+}
+
+void LatencyStatsPoller::notify()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeup = true;
+    }
+    m_cv.notify_one();
+}
+
+void LatencyStatsPoller::run()
+{
+    while (true)
+    {
+        bool pending = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (CollectiveLatencyStats* stats : m_stats)
+            {
+                pending |= stats->poll();
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        if (m_stop) break;
+
+        if (pending)
+        {
+            m_cv.wait_for(lock, std::chrono::microseconds(POLL_INTERVAL_USEC), [this] { return m_stop; });
+        }
+        else
+        {
+            m_cv.wait_for(lock, std::chrono::microseconds(IDLE_INTERVAL_USEC), [this] { return m_stop || m_wakeup; });
+        }
+        m_wakeup = false;
+    }
+}
+
+thread_local ScopedLatencyOp* ScopedLatencyOp::s_current = nullptr;
+
+ScopedLatencyOp::ScopedLatencyOp(CollectiveLatencyStats& stats, HCL_CollectiveOp op)
+: m_stats(stats.isStarted() && s_current == nullptr ? &stats : nullptr), m_op(op)
+{
+    if (m_stats)
+    {
+        // Numbered on entry, so the ranks that submit nothing in the scope still count the collective
+        m_collective = m_stats->nextCollective();
+        m_startNsec  = CollectiveLatencyStats::nowNsec();
+        s_current    = this;
+    }
+}
+
+ScopedLatencyOp::~ScopedLatencyOp()
+{
+    if (!m_stats) return;
+
+    s_current = nullptr;
+    if (m_submitted)
+    {
+        m_stats->queue(
+            {m_op, m_collective, m_startNsec, m_submitNsec, m_archStreamId, m_targetValue, false, {}});
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(m_stats->m_mutex);
+        m_stats->addToReport(m_collective, LATENCY_REPORT_NO_SAMPLE);
+    }
+}
+
+bool ScopedLatencyOp::attach(CollectiveLatencyStats& stats, unsigned archStreamId, uint64_t targetValue)
+{
+    ScopedLatencyOp* scope = s_current;
+    if (scope == nullptr || scope->m_stats != &stats) return false;
+
+    scope->m_submitNsec   = CollectiveLatencyStats::nowNsec();
+    scope->m_submitted    = true;
+    scope->m_archStreamId = archStreamId;
+    scope->m_targetValue  = targetValue;
+
+    return true;
+}
@@ -0,0 +1,319 @@
+#pragma once
+
+#include <array>               // for array
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstdint>             // for uint64_t
+#include <deque>               // for deque
+#include <functional>          // for function
+#include <map>                 // for map
+#include <mutex>               // for mutex
+#include <string>              // for string
+#include <thread>              // for thread
+#include <unordered_map>       // for unordered_map
+#include <vector>              // for vector
+
+#include "hcl_api_types.h"  // for HCL_CollectiveOp, HCL_Comm
+#include "hcl_inc.h"        // for HCL_Rank
+
+/**
+ * Latencies recorded per collective. The host phases and the completion are measured from the moment HCL starts
+ * handling the call.
+ */
+enum class LatencyPhase
+{
+    SUBMIT = 0,   // host: until the last program of the collective is submitted, including waits on credits and buffers
+    SCALE_UP,     // host: building the scale-up send/recv programs, part of submit
+    SCALE_OUT,    // host: scale-out resource negotiation and send/recv programs, part of submit
+    REDUCTION,    // host: DMA programs, i.e. reductions and local copies, part of submit
+    DEVICE_WAIT,  // device: from the collective being submitted and its stream being idle to its completion
+    COMPLETION,   // until the device signals the stream reached the collective's completion target
+    COUNT
+};
+
+constexpr unsigned NUM_LATENCY_PHASES = static_cast<unsigned>(LatencyPhase::COUNT);
+
+const char* toString(LatencyPhase phase);
+
+/**
+ * Fixed-bucket latency histogram. Bucket i counts latencies below 2^i usec that did not fit bucket i-1, the last bucket
+ * is open ended. Recording is a few integer operations and never allocates.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned NUM_BUCKETS = 24;  // last bucket starts at ~4s
+
+    void record(uint64_t latencyUsec);
+    void reset();
+
+    uint64_t count() const { return m_count; }
+    uint64_t sumUsec() const { return m_sumUsec; }
+    uint64_t maxUsec() const { return m_maxUsec; }
+    uint64_t meanUsec() const { return m_count ? m_sumUsec / m_count : 0; }
+
+    /**
+     * @brief upper bound of the bucket holding the given percentile, capped by the largest recorded latency
+     * @param percentile - in [0, 100]
+     */
+    uint64_t percentileUsec(unsigned percentile) const;
+
+    LatencyHistogram& operator+=(const LatencyHistogram& other);
+
+    std::string toString() const;
+
+private:
+    std::array<uint64_t, NUM_BUCKETS> m_buckets = {};
+    uint64_t                          m_count   = 0;
+    uint64_t                          m_sumUsec = 0;
+    uint64_t                          m_maxUsec = 0;
+};
+
+// Collectives per latency report, i.e. the straggler detection window
+constexpr unsigned LATENCY_REPORT_COLLECTIVES = 64;
+
+// Device wait of a collective whose sample was dropped
+constexpr uint32_t LATENCY_REPORT_NO_SAMPLE = UINT32_MAX;
+
+/**
+ * Report of one rank to the coordinator, sent every LATENCY_REPORT_COLLECTIVES completed collectives, and while the
+ * rank's oldest collective does not complete
+ */
+struct LatencyReportMessage
+{
+    HCL_Rank rank;
+    bool     stalled;     // no device waits, the rank waits for collective #window for long
+    uint64_t window;      // collectives [window * LATENCY_REPORT_COLLECTIVES, (window + 1) * LATENCY_REPORT_COLLECTIVES)
+    uint64_t submitted;   // collectives the rank submitted so far
+    uint32_t waitUsec[LATENCY_REPORT_COLLECTIVES];  // device wait of each collective of the window
+};
+
+/**
+ * Collective latency histograms of one communicator, per collective type and phase.
+ *
+ * The API thread only queues a sample with the stream completion target when a collective is submitted. The shared
+ * LatencyStatsPoller checks the queued targets against the device and records the samples once they complete, so the
+ * completion latency resolution is the poll interval. Every window of completed samples is logged, the lifetime
+ * histograms are printed when the communicator is destroyed.
+ *
+ * Collectives are numbered in call order, which is the same on all ranks. The device wait of a collective is short on
+ * the rank that called it last and long on the ranks that waited for it, independently of the hosts' clocks. The
+ * device waits of every LATENCY_REPORT_COLLECTIVES collectives are sent to the coordinator, which compares the ranks
+ * (see StragglerDetector). Reports are sent by the poller, never by the API thread.
+ */
+class CollectiveLatencyStats
+{
+public:
+    // Non blocking check whether a stream reached a completion target
+    using CompletionQuery = std::function<bool(unsigned archStreamId, uint64_t targetValue)>;
+
+    // Sends a report to the coordinator, called from the poller thread
+    using ReportSender = std::function<void(const LatencyReportMessage& report)>;
+
+    // Host time of the submit sub-phases, in nsec, indexed by LatencyPhase
+    using PhaseLatencies = std::array<uint64_t, NUM_LATENCY_PHASES>;
+
+    // Submitted samples are dropped rather than queued beyond this, so a stuck stream can not grow the queue
+    static constexpr unsigned MAX_PENDING_SAMPLES = 4096;
+
+    // A rank whose oldest collective did not complete for this long reports it, at most once per this interval
+    static constexpr uint64_t STALL_REPORT_INTERVAL_USEC = 5000000;
+
+    static constexpr uint64_t NO_COLLECTIVE = UINT64_MAX;
+
+    CollectiveLatencyStats(const HCL_Comm comm) : m_comm(comm) {}
+    ~CollectiveLatencyStats();
+
+    CollectiveLatencyStats(const CollectiveLatencyStats&)            = delete;
+    CollectiveLatencyStats& operator=(const CollectiveLatencyStats&) = delete;
+
+    /**
+     * @brief register with the shared poller, samples are only recorded after it
+     * @param query - completion check of the device streams
+     * @param sender - sends reports to the coordinator, may be empty
+     * @param rank - rank of this process in the communicator
+     * @param windowSize - completed collectives per logged window, 0 to log only the lifetime histograms
+     */
+    void start(CompletionQuery query, ReportSender sender, HCL_Rank rank, uint64_t windowSize);
+
+    /**
+     * @brief unregister from the poller, recording the samples whose streams already completed
+     */
+    void stop();
+
+    bool isStarted() const { return m_started; }
+
+    /**
+     * @brief queue a sample of a collective whose programs were all submitted, called with the stream lock held
+     * @param op - collective type, eHCLNoCollective for a group of send/recv calls
+     * @param startNsec - when HCL started handling the collective, see nowNsec()
+     * @param archStreamId - stream the collective was submitted on
+     * @param targetValue - stream long SO value the collective completes at
+     * @param hostPhases - host time of the submit sub-phases, null if they were not measured
+     */
+    void onSubmit(HCL_CollectiveOp      op,
+                  uint64_t              startNsec,
+                  unsigned              archStreamId,
+                  uint64_t              targetValue,
+                  const PhaseLatencies* hostPhases = nullptr);
+
+    /**
+     * @brief record the samples that completed since the last poll and send the reports that are due
+     * @return true if samples are still pending
+     */
+    bool poll();
+
+    static uint64_t nowNsec();
+
+private:
+    friend class ScopedLatencyOp;
+
+    struct PendingSample
+    {
+        HCL_CollectiveOp op;
+        uint64_t         collective;  // number of the collective, NO_COLLECTIVE for send/recv
+        uint64_t         startNsec;
+        uint64_t         submitNsec;
+        unsigned         archStreamId;
+        uint64_t         targetValue;
+        bool             hasHostPhases;
+        PhaseLatencies   hostPhases;
+    };
+
+    struct OpenReport
+    {
+        LatencyReportMessage message;
+        unsigned             filled;
+    };
+
+    uint64_t nextCollective();
+    void     queue(const PendingSample& sample);
+    void     pollCompletions(std::unique_lock<std::mutex>& lock);
+    void     record(const PendingSample& sample, uint64_t completionNsec);
+    void     addToReport(uint64_t collective, uint32_t waitUsec);
+    void     checkStall(uint64_t nowNsec);
+    void     logWindow();
+
+    const HCL_Comm  m_comm;
+    CompletionQuery m_query;
+    ReportSender    m_sender;
+    HCL_Rank        m_rank       = 0;
+    uint64_t        m_windowSize = 0;
+    bool            m_started    = false;
+
+    std::mutex                m_mutex;
+    std::deque<PendingSample> m_pending;
+    uint64_t                  m_dropped = 0;
+
+    // Collectives numbered so far, and the reports of the windows not completed yet
+    std::atomic<uint64_t>                  m_collectives {0};
+    std::map<uint64_t, OpenReport>         m_openReports;
+    std::vector<LatencyReportMessage>      m_readyReports;
+    uint64_t                               m_lastStallReportNsec = 0;
+    std::unordered_map<unsigned, uint64_t> m_lastCompletionNsec;  // per stream
+
+    // Lifetime histograms per collective type, and the current window of all types
+    std::array<std::array<LatencyHistogram, NUM_LATENCY_PHASES>, eHCLCollectiveLastValue> m_histograms;
+    std::array<LatencyHistogram, NUM_LATENCY_PHASES>                                      m_window;
+};
+
+/**
+ * Process wide thread polling the started latency stats of all communicators. It polls every POLL_INTERVAL_USEC while
+ * samples are pending, and every IDLE_INTERVAL_USEC otherwise to notice stalls. It runs while any stats are started.
+ */
+class LatencyStatsPoller
+{
+public:
+    static constexpr uint64_t POLL_INTERVAL_USEC = 20;
+    static constexpr uint64_t IDLE_INTERVAL_USEC = 100000;
+
+    static LatencyStatsPoller& instance();
+
+    void add(CollectiveLatencyStats* stats);
+
+    /**
+     * @brief stop polling the stats, returns once a poll of them in progress is done
+     */
+    void remove(CollectiveLatencyStats* stats);
+
+    /**
+     * @brief wake the poller up, a sample was queued to idle stats
+     */
+    void notify();
+
+private:
+    LatencyStatsPoller() = default;
+    void run();
+
+    std::mutex                           m_lifecycleMutex;  // serializes add and remove, which start and join m_thread
+    std::mutex                           m_mutex;           // held for a poll of all stats
+    std::vector<CollectiveLatencyStats*> m_stats;
+    std::thread                          m_thread;
+
+    std::mutex              m_wakeMutex;
+    std::condition_variable m_cv;
+    bool                    m_stop   = false;
+    bool                    m_wakeup = false;
+};
+
+/**
+ * Attributes the send/recv groups the calling thread submits in its scope to the collective built from them (pipelined
+ * broadcast). They are recorded as a single sample of that collective, from the start of the scope to the completion
+ * of the last group, instead of a send/recv sample per group.
+ */
+class ScopedLatencyOp
+{
+public:
+    ScopedLatencyOp(CollectiveLatencyStats& stats, HCL_CollectiveOp op);
+    ~ScopedLatencyOp();
+
+    ScopedLatencyOp(const ScopedLatencyOp&)            = delete;
+    ScopedLatencyOp& operator=(const ScopedLatencyOp&) = delete;
+
+    /**
+     * @brief take a submitted sample of the stats if a scope on them is active on this thread
+     * @return true if the sample was taken, i.e. must not be queued on its own
+     */
+    static bool attach(CollectiveLatencyStats& stats, unsigned archStreamId, uint64_t targetValue);
+
+private:
+    static thread_local ScopedLatencyOp* s_current;
+
+    CollectiveLatencyStats* m_stats;  // null when stats are disabled or an outer scope is active
+    HCL_CollectiveOp        m_op;
+    uint64_t                m_collective   = CollectiveLatencyStats::NO_COLLECTIVE;
+    uint64_t                m_startNsec    = 0;
+    uint64_t                m_submitNsec   = 0;
+    bool                    m_submitted    = false;
+    unsigned                m_archStreamId = 0;
+    uint64_t                m_targetValue  = 0;
+};
+
+/**
+ * Adds the host time spent in its scope to a submit sub-phase of a collective. A null accumulator, i.e. latency stats
+ * disabled, makes it a no-op that does not read the clock.
+ */
+class ScopedPhaseTimer
+{
+public:
+    ScopedPhaseTimer(CollectiveLatencyStats::PhaseLatencies* latencies, LatencyPhase phase)
+    : m_latencies(latencies), m_phase(phase), m_startNsec(latencies ? CollectiveLatencyStats::nowNsec() : 0)
+    {
+    }
+
+    ~ScopedPhaseTimer()
+    {
+        if (m_latencies)
+        {
+            (*m_latencies)[static_cast<unsigned>(m_phase)] += CollectiveLatencyStats::nowNsec() - m_startNsec;
+        }
+    }
+
+    ScopedPhaseTimer(const ScopedPhaseTimer&)            = delete;
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+private:
+    CollectiveLatencyStats::PhaseLatencies* m_latencies;
+    const LatencyPhase                      m_phase;
+    const uint64_t                          m_startNsec;
+};
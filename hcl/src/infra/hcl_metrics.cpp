@@ -0,0 +1,294 @@
+#include "infra/hcl_metrics.h"
+
+#include <algorithm>          // for max, remove_if
+#include <chrono>             // for steady_clock
+#include <cstdio>             // for rename, remove
+#include <fstream>            // for ofstream
+#include "hcl_global_conf.h"  // for GCFG_HCL_METRICS_DIR
+#include "hcl_types.h"        // for operator<< of HCL_CollectiveOp
+#include "hcl_utils.h"        // for LOG_WARN_RATELIMITTER
+#include "hcl_log_manager.h"  // for LOG_*
+
+std::mutex                                 HclMetricsExporter::s_commsMutex;
+std::vector<std::weak_ptr<HclCommMetrics>> HclMetricsExporter::s_comms;
+
+static uint64_t nowNsec()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static std::string escapeLabelValue(const std::string& value)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const char c : value)
+    {
+        if (c == '\\' || c == '"')
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (c == '\n')
+        {
+            escaped += "\\n";
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+void HclMetricsWriter::counter(const std::string& name, const std::string& help, const Labels& labels, uint64_t value)
+{
+    add(name, help, "counter", labels, std::to_string(value));
+}
+
+void HclMetricsWriter::gauge(const std::string& name, const std::string& help, const Labels& labels, double value)
+{
+    add(name, help, "gauge", labels, fmt::format("{}", value));
+}
+
+void HclMetricsWriter::untyped(const std::string& name, const std::string& help, const Labels& labels, uint64_t value)
+{
+    add(name, help, "untyped", labels, std::to_string(value));
+}
+
+void HclMetricsWriter::add(const std::string& name,
+                           const std::string& help,
+                           const char*        type,
+                           const Labels&      labels,
+                           const std::string& value)
+{
+    auto it = m_metrics.find(name);
+    if (it == m_metrics.end())
+    {
+        m_order.push_back(name);
+        it = m_metrics.emplace(name, Metric {help, type, {}}).first;
+    }
+
+    std::string sample = name;
+    if (!labels.empty())
+    {
+        sample += '{';
+        for (size_t i = 0; i < labels.size(); i++)
+        {
+            sample += fmt::format("{}{}=\"{}\"", i ? "," : "", labels[i].first, escapeLabelValue(labels[i].second));
+        }
+        sample += '}';
+    }
+    sample += ' ';
+    sample += value;
+
+    it->second.samples.push_back(std::move(sample));
+}
+
+std::string HclMetricsWriter::str() const
+{
+    std::string out;
+    for (const std::string& name : m_order)
+    {
+        const Metric& metric = m_metrics.at(name);
+        out += fmt::format("# HELP {} {}\n# TYPE {} {}\n", name, metric.help, name, metric.type);
+        for (const std::string& sample : metric.samples)
+        {
+            out += sample;
+            out += '\n';
+        }
+    }
+    return out;
+}
+
+HclCommMetrics::HclCommMetrics(const std::string& uniqueId,
+                               const HCL_Comm     comm,
+                               const HCL_Rank     rank,
+                               const uint32_t     commSize)
+: uniqueId(uniqueId), comm(comm), rank(rank), commSize(std::max(commSize, 1u))
+{
+}
+
+void HclCommMetrics::onCollective(HCL_CollectiveOp op, uint64_t count, uint64_t dataTypeSize)
+{
+    if (op >= eHCLCollectiveLastValue) return;
+
+    const double ranks     = commSize;
+    uint64_t     size      = count * dataTypeSize;
+    double       busFactor = 1;
+    switch (op)
+    {
+        case eHCLAllReduce:
+            busFactor = 2 * (ranks - 1) / ranks;
+            break;
+        case eHCLAllGather:
+            size *= commSize;  // the count is of a single rank's input
+            busFactor = (ranks - 1) / ranks;
+            break;
+        case eHCLReduceScatter:
+        case eHCLAll2All:
+            busFactor = (ranks - 1) / ranks;
+            break;
+        default:
+            break;
+    }
+
+    collectives[op].fetch_add(1, std::memory_order_relaxed);
+    algBytes[op].fetch_add(size, std::memory_order_relaxed);
+    busBytes[op].fetch_add(size * busFactor, std::memory_order_relaxed);
+}
+
+void HclCommMetrics::onSend(uint64_t bytes)
+{
+    sends.fetch_add(1, std::memory_order_relaxed);
+    sendBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void HclCommMetrics::onRecv(uint64_t bytes)
+{
+    recvs.fetch_add(1, std::memory_order_relaxed);
+    recvBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+HclMetricsExporter::HclMetricsExporter(const std::string& path, const uint64_t intervalMs, Collector deviceCollector)
+: m_path(path), m_intervalMs(std::max<uint64_t>(intervalMs, 1)), m_deviceCollector(deviceCollector)
+{
+    LOG_INFO(HCL, "Exporting metrics to {} every {}ms", m_path, m_intervalMs);
+    m_thread = std::thread(&HclMetricsExporter::run, this);
+}
+
+HclMetricsExporter::~HclMetricsExporter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_one();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    // The process is gone, its last values must not be reported as current
+    std::remove(m_path.c_str());
+}
+
+std::shared_ptr<HclCommMetrics> HclMetricsExporter::registerComm(const std::string& uniqueId,
+                                                                 const HCL_Comm     comm,
+                                                                 const HCL_Rank     rank,
+                                                                 const uint32_t     commSize)
+{
+    if (GCFG_HCL_METRICS_DIR.value().empty())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<HclCommMetrics> metrics = std::make_shared<HclCommMetrics>(uniqueId, comm, rank, commSize);
+
+    std::lock_guard<std::mutex> lock(s_commsMutex);
+    s_comms.push_back(metrics);
+
+    return metrics;
+}
+
+void HclMetricsExporter::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_cv.wait_for(lock, std::chrono::milliseconds(m_intervalMs), [this] { return m_stop; }))
+    {
+        lock.unlock();
+        writeSample();
+        lock.lock();
+    }
+}
+
+void HclMetricsExporter::writeSample()
+{
+    HclMetricsWriter writer;
+    collectComms(writer);
+    if (m_deviceCollector)
+    {
+        m_deviceCollector(writer);
+    }
+
+    const std::string tmpPath = m_path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::trunc);
+        file << writer.str();
+        if (!file.good())
+        {
+            LOG_WARN_RATELIMITTER(HCL, 60000, "Failed writing metrics to {}", tmpPath);
+            return;
+        }
+    }
+
+    if (std::rename(tmpPath.c_str(), m_path.c_str()) != 0)
+    {
+        LOG_WARN_RATELIMITTER(HCL, 60000, "Failed renaming metrics file {} to {}", tmpPath, m_path);
+    }
+}
+
+void HclMetricsExporter::collectComms(HclMetricsWriter& writer)
+{
+    std::vector<std::shared_ptr<HclCommMetrics>> comms;
+    {
+        std::lock_guard<std::mutex> lock(s_commsMutex);
+        s_comms.erase(std::remove_if(s_comms.begin(),
+                                     s_comms.end(),
+                                     [](const std::weak_ptr<HclCommMetrics>& comm) { return comm.expired(); }),
+                      s_comms.end());
+        for (const std::weak_ptr<HclCommMetrics>& comm : s_comms)
+        {
+            if (std::shared_ptr<HclCommMetrics> metrics = comm.lock()) comms.push_back(metrics);
+        }
+    }
+
+    const uint64_t now = nowNsec();
+    for (const std::shared_ptr<HclCommMetrics>& metrics : comms)
+    {
+        const HclMetricsWriter::Labels commLabels = {{"comm", metrics->uniqueId},
+                                                     {"rank", std::to_string(metrics->rank)},
+                                                     {"size", std::to_string(metrics->commSize)}};
+
+        uint64_t totalAlgBytes = 0;
+        uint64_t totalBusBytes = 0;
+        for (unsigned op = 0; op < eHCLCollectiveLastValue; op++)
+        {
+            const uint64_t collectives = metrics->collectives[op].load(std::memory_order_relaxed);
+            if (collectives == 0) continue;
+
+            const uint64_t algBytes = metrics->algBytes[op].load(std::memory_order_relaxed);
+            const uint64_t busBytes = metrics->busBytes[op].load(std::memory_order_relaxed);
+            totalAlgBytes += algBytes;
+            totalBusBytes += busBytes;
+
+            HclMetricsWriter::Labels labels = commLabels;
+            labels.emplace_back("op", fmt::format("{}", HCL_CollectiveOp(op)));
+            writer.counter("hccl_collectives_total", "Collective calls", labels, collectives);
+            writer.counter("hccl_collective_bytes_total", "Collective algorithm bytes", labels, algBytes);
+            writer.counter("hccl_collective_bus_bytes_total", "Collective bus bytes", labels, busBytes);
+        }
+
+        writer.counter("hccl_sends_total", "Point to point sends", commLabels, metrics->sends.load());
+        writer.counter("hccl_recvs_total", "Point to point receives", commLabels, metrics->recvs.load());
+        writer.counter("hccl_send_bytes_total", "Point to point bytes sent", commLabels, metrics->sendBytes.load());
+        writer.counter("hccl_recv_bytes_total", "Point to point bytes received", commLabels, metrics->recvBytes.load());
+
+        // Bandwidths over the last interval, for collectors that do not compute rates of the counters themselves
+        if (metrics->lastSampleNsec != 0 && now > metrics->lastSampleNsec)
+        {
+            const double seconds = (now - metrics->lastSampleNsec) / 1e9;
+            writer.gauge("hccl_collective_algbw_bytes_per_second",
+                         "Collective algorithm bandwidth over the last sample interval",
+                         commLabels,
+                         (totalAlgBytes - metrics->lastAlgBytes) / seconds);
+            writer.gauge("hccl_collective_busbw_bytes_per_second",
+                         "Collective bus bandwidth over the last sample interval",
+                         commLabels,
+                         (totalBusBytes - metrics->lastBusBytes) / seconds);
+        }
+        metrics->lastSampleNsec = now;
+        metrics->lastAlgBytes   = totalAlgBytes;
+        metrics->lastBusBytes   = totalBusBytes;
+    }
+}
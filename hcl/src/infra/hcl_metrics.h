@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>               // for array
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstdint>             // for uint64_t
+#include <functional>          // for function
+#include <memory>              // for shared_ptr, weak_ptr
+#include <mutex>               // for mutex
+#include <string>              // for string
+#include <thread>              // for thread
+#include <unordered_map>       // for unordered_map
+#include <utility>             // for pair
+#include <vector>              // for vector
+
+#include "hcl_api_types.h"  // for HCL_CollectiveOp, HCL_Comm
+#include "hcl_inc.h"        // for HCL_Rank
+
+/**
+ * Builds one sample of all metrics in the Prometheus text exposition format. Samples of a metric are grouped under a
+ * single HELP/TYPE header, metrics are written in the order they were first added.
+ */
+class HclMetricsWriter
+{
+public:
+    using Labels = std::vector<std::pair<std::string, std::string>>;
+
+    void counter(const std::string& name, const std::string& help, const Labels& labels, uint64_t value);
+    void gauge(const std::string& name, const std::string& help, const Labels& labels, double value);
+    void untyped(const std::string& name, const std::string& help, const Labels& labels, uint64_t value);
+
+    std::string str() const;
+
+private:
+    struct Metric
+    {
+        std::string              help;
+        const char*              type;
+        std::vector<std::string> samples;
+    };
+
+    void add(const std::string& name,
+             const std::string& help,
+             const char*        type,
+             const Labels&      labels,
+             const std::string& value);
+
+    std::vector<std::string>                m_order;
+    std::unordered_map<std::string, Metric> m_metrics;
+};
+
+/**
+ * Throughput counters of one communicator. The API thread updates them with relaxed atomics, the exporter reads them
+ * from its own thread.
+ */
+struct HclCommMetrics
+{
+    HclCommMetrics(const std::string& uniqueId, const HCL_Comm comm, const HCL_Rank rank, const uint32_t commSize);
+
+    /**
+     * @brief account one collective call
+     * @param op - collective type
+     * @param count - element count of the call as HCL sees it (the send count for reduce-scatter)
+     * @param dataTypeSize - element size in bytes
+     */
+    void onCollective(HCL_CollectiveOp op, uint64_t count, uint64_t dataTypeSize);
+    void onSend(uint64_t bytes);
+    void onRecv(uint64_t bytes);
+
+    const std::string uniqueId;
+    const HCL_Comm    comm;
+    const HCL_Rank    rank;
+    const uint32_t    commSize;
+
+    // Per collective type. Algorithm bytes follow the usual size definition of each collective, bus bytes scale them
+    // by the share of the data that has to cross the links, so their rates are the algorithm and bus bandwidths.
+    std::array<std::atomic<uint64_t>, eHCLCollectiveLastValue> collectives = {};
+    std::array<std::atomic<uint64_t>, eHCLCollectiveLastValue> algBytes    = {};
+    std::array<std::atomic<uint64_t>, eHCLCollectiveLastValue> busBytes    = {};
+
+    std::atomic<uint64_t> sends     = {0};
+    std::atomic<uint64_t> recvs     = {0};
+    std::atomic<uint64_t> sendBytes = {0};
+    std::atomic<uint64_t> recvBytes = {0};
+
+    // Totals at the previous sample, owned by the exporter thread
+    uint64_t lastSampleNsec = 0;
+    uint64_t lastAlgBytes   = 0;
+    uint64_t lastBusBytes   = 0;
+};
+
+/**
+ * Background sampler writing the metrics of the process to a file, for a node level collector (e.g. the textfile
+ * collector of the Prometheus node exporter) to pull.
+ *
+ * Every interval it samples all live communicators and the device collector, writes the sample next to the file and
+ * renames it over the file, so readers never see a partial sample. The file is removed when the exporter stops.
+ */
+class HclMetricsExporter
+{
+public:
+    using Collector = std::function<void(HclMetricsWriter&)>;
+
+    HclMetricsExporter(const std::string& path, const uint64_t intervalMs, Collector deviceCollector);
+    ~HclMetricsExporter();
+
+    HclMetricsExporter(const HclMetricsExporter&)            = delete;
+    HclMetricsExporter& operator=(const HclMetricsExporter&) = delete;
+
+    /**
+     * @brief create the counters of a new communicator
+     * @return the counters, or null when metrics are not exported
+     */
+    static std::shared_ptr<HclCommMetrics>
+    registerComm(const std::string& uniqueId, const HCL_Comm comm, const HCL_Rank rank, const uint32_t commSize);
+
+private:
+    void run();
+    void writeSample();
+    void collectComms(HclMetricsWriter& writer);
+
+    const std::string m_path;
+    const uint64_t    m_intervalMs;
+    const Collector   m_deviceCollector;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    bool                    m_stop = false;
+    std::thread             m_thread;
+
+    // Communicators are registered by their creator and expire with it
+    static std::mutex                                 s_commsMutex;
+    static std::vector<std::weak_ptr<HclCommMetrics>> s_comms;
+};
@@ -0,0 +1,152 @@
+#include "infra/hcl_node_cache.h"
+
+#include <algorithm>          // for sort
+#include <cstdio>             // for rename, remove
+#include <dirent.h>           // for opendir, readdir
+#include <fstream>            // for ifstream, ofstream
+#include <iterator>           // for istreambuf_iterator
+#include <unistd.h>           // for getpid
+#include <vector>             // for vector
+#include "hcl_global_conf.h"  // for GCFG_HCL_NODE_CACHE_DIR
+#include "hcl_utils.h"        // for LOG_*
+#include "hcl_log_manager.h"  // for LOG_*
+
+namespace hcl::node_cache
+{
+// Bumped when the layout of the entries changes, so entries of older versions are stale
+static constexpr unsigned FORMAT_VERSION = 1;
+
+static std::string readBootId()
+{
+    std::ifstream file("/proc/sys/kernel/random/boot_id");
+    std::string   bootId;
+    std::getline(file, bootId);
+    return bootId;
+}
+
+// FNV-1a of the sorted PCI addresses, detects devices that were added, removed or moved
+static uint64_t hashPciDevices()
+{
+    std::vector<std::string> devices;
+
+    DIR* dir = opendir("/sys/bus/pci/devices");
+    if (dir != nullptr)
+    {
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != nullptr)
+        {
+            if (entry->d_name[0] != '.')
+            {
+                devices.push_back(entry->d_name);
+            }
+        }
+        closedir(dir);
+    }
+
+    std::sort(devices.begin(), devices.end());
+
+    uint64_t hash = 0xcbf29ce484222325;
+    for (const std::string& device : devices)
+    {
+        for (const char c : device + ";")
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 0x100000001b3;
+        }
+    }
+
+    return hash;
+}
+
+static std::string computeFingerprint()
+{
+    const std::string bootId = readBootId();
+    if (bootId.empty())
+    {
+        // Without a boot id an entry could survive a reboot into other hardware or another kernel
+        LOG_WARN(HCL, "Cannot read the boot id, node cache is disabled");
+        return "";
+    }
+
+    return fmt::format("v{} boot {} pci {:016x}", FORMAT_VERSION, bootId, hashPciDevices());
+}
+
+const std::string& fingerprint()
+{
+    static const std::string s_fingerprint = computeFingerprint();
+    return s_fingerprint;
+}
+
+static bool isEnabled()
+{
+    return !GCFG_HCL_NODE_CACHE_DIR.value().empty() && !fingerprint().empty();
+}
+
+static std::string entryPath(const std::string& name)
+{
+    return fmt::format("{}/hcl_{}.cache", GCFG_HCL_NODE_CACHE_DIR.value(), name);
+}
+
+std::optional<std::string> load(const std::string& name)
+{
+    if (!isEnabled()) return std::nullopt;
+
+    const std::string path = entryPath(name);
+    std::ifstream     file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        LOG_DEBUG(HCL, "Node cache miss, {} does not exist", path);
+        return std::nullopt;
+    }
+
+    std::string entryFingerprint;
+    std::getline(file, entryFingerprint);
+    if (entryFingerprint != fingerprint())
+    {
+        LOG_INFO(HCL,
+                 "Node cache entry {} is stale, it is of \"{}\" and the node is \"{}\"",
+                 path,
+                 entryFingerprint,
+                 fingerprint());
+        return std::nullopt;
+    }
+
+    std::string value((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad())
+    {
+        LOG_WARN(HCL, "Failed reading node cache entry {}", path);
+        return std::nullopt;
+    }
+
+    LOG_DEBUG(HCL, "Node cache hit, {} ({} bytes)", path, value.size());
+    return value;
+}
+
+void store(const std::string& name, const std::string& value)
+{
+    if (!isEnabled()) return;
+
+    const std::string path    = entryPath(name);
+    const std::string tmpPath = fmt::format("{}.{}", path, getpid());
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file << fingerprint() << '\n' << value;
+        if (!file.good())
+        {
+            LOG_WARN(HCL, "Failed writing node cache entry {}", tmpPath);
+            file.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        LOG_WARN(HCL, "Failed renaming node cache entry {} to {}", tmpPath, path);
+        std::remove(tmpPath.c_str());
+        return;
+    }
+
+    LOG_DEBUG(HCL, "Node cache entry {} stored ({} bytes)", path, value.size());
+}
+}  // namespace hcl::node_cache
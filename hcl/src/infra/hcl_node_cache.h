@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>  // for optional
+#include <string>    // for string
+
+/**
+ * Node-local cache of discovery results that are expensive to compute but only change with the hardware or the
+ * kernel, e.g. the hwloc topology or kernel capabilities. It lets a process that restarts on the same node (after a
+ * preemption, or the other ranks of the node) skip the discovery.
+ *
+ * Entries are files in HCL_NODE_CACHE_DIR, caching is disabled when it is not set. Each entry is stored with the node
+ * fingerprint (boot id and PCI device list) it was computed under, an entry of another fingerprint is stale: it is not
+ * returned, and the caller recomputes and stores it again.
+ */
+namespace hcl::node_cache
+{
+/**
+ * @brief the fingerprint of the node, computed once per process
+ */
+const std::string& fingerprint();
+
+/**
+ * @brief read an entry
+ * @param name - entry name, also the file name
+ * @return the stored value, or nothing when caching is disabled, the entry is missing or it is stale
+ */
+std::optional<std::string> load(const std::string& name);
+
+/**
+ * @brief store an entry under the current fingerprint, replacing the previous one. Ranks of the node may store
+ *        concurrently, the entry is written to a temporary file and renamed so readers never see a partial entry.
+ */
+void store(const std::string& name, const std::string& value);
+}  // namespace hcl::node_cache
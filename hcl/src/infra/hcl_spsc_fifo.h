@@ -7,7 +7,10 @@
 // since both pointers are only modified in a single thread, locklessness can be achieved easily
 //
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <thread>
 #include <type_traits>
 #include <sstream>
 
@@ -18,6 +21,12 @@
 #define likely(x) __builtin_expect(!!(x), 1)
 #endif
 
+#ifndef unlikely
+#define unlikely(x) __builtin_expect(!!(x), 0)
+#endif
+
+constexpr size_t SPSC_FIFO_CACHE_LINE_SIZE = 64;
+
 /**
  * Implementation of a lock-free Single Producer, Single Consumer FIFO queue, with possibly-continuous elements.
  *
@@ -28,8 +37,19 @@
  * Locklessness is achieved by the fact that all the iterators used are only written by a single thread - the 'pi'
  * variables are written by the producer thread and the 'ci' by the consumer thread. The other thread can (and should)
  * read the data of the other thread but as long as no modification is made to the cross-thread variables coherency is
- * achieved. A caveat is that a thread may look at another's 'old' data (but when it re-loops on it the data will be
- * 'new'), so there might be a small latency cost.
+ * achieved.
+ *
+ * Indices are absolute (they never wrap) and are masked only when addressing the buffer. Producer and consumer state
+ * live on separate cache lines, and each side keeps a cached copy of the other side's index which it refreshes only
+ * when the cached value says it must wait, so the hot path does not touch the other thread's cache line.
+ *
+ * When a write does not fit before the end of the buffer, the producer records the position where the data ends in
+ * the watermark and continues from the start of the buffer. The consumer skips to the start once it reaches the
+ * watermark and the producer has published data past it.
+ *
+ * Several writes can be published together: between beginBatch() and endBatch() submit() only reserves, and the whole
+ * batch becomes visible to the consumer at once. A batch that would block on a full FIFO is published early so the
+ * consumer can drain it.
  *
  * WARNING: Using multiple threads to produce or to consume will result in undefined behaviour.
  */
@@ -37,172 +57,125 @@
 template<uint64_t CAPACITY>
 class spsc_fifo_t
 {
+    static constexpr uint64_t MASK = CAPACITY - 1;
+
+    // Number of pause iterations before a waiting producer starts yielding its CPU
+    static constexpr uint64_t SPIN_PAUSE_LIMIT = 1024;
+
 public:
     spsc_fifo_t(const std::string name = "NoName") : m_name(name)
     {
         VERIFY(CAPACITY >= 2, "the spsc fifo is not large enough");
         VERIFY((CAPACITY & (CAPACITY - 1)) == 0, "spsc's size must be a power of 2");
-
-        m_ci = 0;
-
-        m_pi        = 0;
-        m_next_pi   = 0;
-        m_watermark = 0;
     }
 
     virtual ~spsc_fifo_t() = default;
 
-    inline uint64_t getCi()
-    {
-        static const uint64_t shift = std::log2(CAPACITY);
-        static const uint64_t mask  = ((1 << shift) - 1);
+    inline uint64_t getCi() const { return m_consumer.ci.load(std::memory_order_relaxed) & MASK; }
 
-        return m_ci & mask;
-    }
+    inline uint64_t getPi() const { return m_producer.pi.load(std::memory_order_relaxed) & MASK; }
 
-    inline uint64_t getPi()
-    {
-        static const uint64_t shift = std::log2(CAPACITY);
-        static const uint64_t mask  = ((1 << shift) - 1);
+    inline uint64_t getNextPi() const { return m_producer.nextPi & MASK; }
 
-        return m_pi & mask;
-    }
+    inline uint64_t getWatermark() const { return m_producer.watermark.load(std::memory_order_relaxed) & MASK; }
 
-    inline uint64_t getNextPi()
+    /**
+     * @brief published dwords the consumer did not read yet, including wrap padding. Safe to call from any thread.
+     */
+    inline uint64_t getOccupancy() const
     {
-        static const uint64_t shift = std::log2(CAPACITY);
-        static const uint64_t mask  = ((1 << shift) - 1);
-
-        return m_next_pi & mask;
+        // ci never passes pi, so reading ci first cannot yield a negative occupancy
+        const uint64_t ci = m_consumer.ci.load(std::memory_order_acquire);
+        return m_producer.pi.load(std::memory_order_acquire) - ci;
     }
 
-    inline uint64_t getWatermark()
+    inline bool isEmpty() const
     {
-        static const uint64_t shift = std::log2(CAPACITY);
-        static const uint64_t mask  = ((1 << shift) - 1);
-
-        return m_watermark & mask;
+        return m_consumer.ci.load(std::memory_order_acquire) >= m_producer.pi.load(std::memory_order_acquire);
     }
 
-    inline bool isEmpty() { return m_ci >= m_pi; }
-
-    inline bool isFull() { return getCi() == getPi() && !isEmpty(); }
-
     inline uint32_t* getNextPtr(uint64_t sizeInDwords)
     {
         VERIFY(likely(sizeInDwords <= CAPACITY));
 
-        while (isFull())
-        {
-            if (unlikely(LOG_LEVEL_AT_LEAST_WARN(HCL)))
-            {
-                LOG_WARN_RATELIMITTER(HCL,
-                                      1000,  // msec
-                                      "FIFO is still full, name={}",
-                                      m_name);
-            }
-        }
+        uint64_t       writePos = m_producer.nextPi;
+        const uint64_t tailRoom = CAPACITY - (writePos & MASK);
 
-        uint32_t* ret = &m_buf[getPi()];
-        if (getPi() >= getCi())
-        {
-            // m_pi is ahead of m_ci, no worries we overtake it. Check if we have continuous room till the end.
-            if (sizeInDwords > (CAPACITY - getPi()))
-            {
-                // We don't have continuous room to write 'sizeInDwords' elements, so we need to wrap-around back to the
-                // start of the buffer. When we do, it's possible that the producer (this thread) is too far ahead of
-                // the consumer (ci) - so we wait until we're more or less aligned.
-                // However, if, for example, the producer wrote CAPACITY elements and is now wrapping
-                // around, but the consumer didn't read anything yet. If we don't wait here, the producer will just
-                // keep writing.
-                m_watermark = m_pi;
-                m_next_pi += (CAPACITY - getPi());
-                ret = &m_buf[getNextPi()];
-
-                while (m_next_pi + sizeInDwords - m_ci >= CAPACITY)
-                {
-                }
-            }
-        }
+        // We don't have continuous room to write 'sizeInDwords' elements, so the tail of the buffer is skipped and
+        // the write starts at the beginning of the buffer.
+        const uint64_t padding = sizeInDwords > tailRoom ? tailRoom : 0;
 
-        if (getPi() < getCi())
-        {
-            // So m_pi is behind m_ci, meaning the producer wrapped around and the consumer is catching up.
-            // We must wait until we have enough room to write (the space between m_pi and m_ci is big enough).
-            if (getCi() - getPi() <= sizeInDwords)
-            {
-                while (!isEmpty())
-                {
-                }
-            }
+        // Wait until the consumer freed enough room for the padding and the data. This must happen before the
+        // watermark is moved, as the consumer may still be reading up to the previous one.
+        waitForRoom(writePos + padding + sizeInDwords);
 
-            if (sizeInDwords > CAPACITY - getPi())
-            {
-                // If we reached here - it means that while the consumer caught up - we still don't have enough space
-                // to write 'sizeInDwords' continuous elements, so we must wrap around.
-                m_watermark = m_pi;
-                m_next_pi += (CAPACITY - getPi());
-                ret = &m_buf[getNextPi()];
-            }
+        if (padding > 0)
+        {
+            m_producer.watermark.store(writePos, std::memory_order_relaxed);
+            writePos += padding;
         }
 
-        // Finally we are good - return the current 'pi' pointer to the user and make sure to self-mark the next pi
-        // (for submit).
-        m_next_pi += sizeInDwords;
-        return ret;
+        m_producer.nextPi = writePos + sizeInDwords;
+        return &m_buf[writePos & MASK];
     }
 
     inline void submit(bool force = false)
     {
         // submit() is called when the user has done writing and the data should be 'submitted' (i.e. read) by the
-        // consumer.
-        m_pi = m_next_pi;
+        // consumer. Inside a batch the data is published by endBatch() unless forced.
+        if (m_producer.batchDepth == 0 || force)
+        {
+            publish();
+        }
     }
 
-    inline uint32_t* read(uint64_t* sizeInDwords)
-    {
-        uint32_t* ret = &m_buf[getCi()];
+    inline void beginBatch() { m_producer.batchDepth++; }
 
-        // We need the make sure the consumer didn't overtake the producer (and if we did - wait for the producer to
-        // catch up. This can happen if, for example, the producer wrote CAPACITY elements and the consumer read all
-        // of these elements. When the consumer free()s the data, it will wrap-around, but the producer will only
-        // wrap-around when new elements want to be written.
-        if (isEmpty())
+    inline void endBatch()
+    {
+        VERIFY(m_producer.batchDepth > 0, "endBatch without beginBatch, name={}", m_name);
+        if (--m_producer.batchDepth == 0)
         {
-            *sizeInDwords = 0;
-            return ret;
+            publish();
         }
+    }
 
-        if (unlikely(m_ci <= m_watermark && m_watermark <= m_pi && m_watermark > 0))
+    inline uint32_t* read(uint64_t* sizeInDwords)
+    {
+        uint64_t ci = m_consumer.ci.load(std::memory_order_relaxed);
+
+        // Only look at the producer's cache line when everything seen so far was consumed
+        if (ci >= m_consumer.cachedPi)
         {
-            // m_ci is at m_watermark, need to wrap-around and read until m_pi
-            if (m_ci == m_watermark && m_watermark < m_pi)
+            m_consumer.cachedPi = m_producer.pi.load(std::memory_order_acquire);
+            if (ci >= m_consumer.cachedPi)
             {
-                m_ci += CAPACITY - getCi();
-                *sizeInDwords = m_pi - m_ci;
-                ret           = &m_buf[getCi()];
-            }
-            // m_ci is ahead of m_pi, so read until the watermark.
-            else
-            {
-                *sizeInDwords = getWatermark() - getCi();
+                *sizeInDwords = 0;
+                return &m_buf[ci & MASK];
             }
         }
-        else
+
+        const uint64_t pi        = m_consumer.cachedPi;
+        const uint64_t watermark = m_producer.watermark.load(std::memory_order_acquire);
+        uint64_t       end       = pi;
+
+        // The producer wrapped around within the published data. A real watermark never sits on the start of the
+        // buffer, which tells it apart from the initial value.
+        if ((watermark & MASK) != 0 && ci <= watermark && watermark < pi)
         {
-            // m_ci is behind m_pi, so read until m_pi.
-            *sizeInDwords = m_pi - m_ci;
-            if (m_ci <= m_watermark && m_watermark <= m_pi && m_watermark > 0)
+            if (ci == watermark)
             {
-                *sizeInDwords = getWatermark() - getCi();
+                ci += CAPACITY - (ci & MASK);
+                m_consumer.ci.store(ci, std::memory_order_release);
             }
-            else if (*sizeInDwords > (CAPACITY - getCi()))
+            else
             {
-                *sizeInDwords = CAPACITY - getCi();
+                end = watermark;
             }
         }
 
-        return ret;
+        *sizeInDwords = std::min(end - ci, CAPACITY - (ci & MASK));
+        return &m_buf[ci & MASK];
     }
 
     inline void free(uint64_t sizeInDwords)
@@ -210,20 +183,63 @@ public:
         VERIFY(likely(sizeInDwords <= CAPACITY), "sizeInDwords: {} > CAP: {}", sizeInDwords, CAPACITY);
 
         // free() 'sizeInDwords' elements, i.e. signify that we're done with consuming this information.
-        m_ci += sizeInDwords;
-        if (m_ci == m_watermark && m_watermark > 0)
+        m_consumer.ci.store(m_consumer.ci.load(std::memory_order_relaxed) + sizeInDwords, std::memory_order_release);
+    }
+
+private:
+    inline void publish() { m_producer.pi.store(m_producer.nextPi, std::memory_order_release); }
+
+    inline void waitForRoom(uint64_t writeEnd)
+    {
+        uint64_t spins = 0;
+        while (writeEnd - m_producer.cachedCi > CAPACITY)
         {
-            m_ci += (CAPACITY - getCi());
+            m_producer.cachedCi = m_consumer.ci.load(std::memory_order_acquire);
+            if (writeEnd - m_producer.cachedCi <= CAPACITY) break;
+
+            // The consumer drained everything published but the pending batch still does not fit, so publish it
+            if (m_producer.cachedCi >= m_producer.pi.load(std::memory_order_relaxed) &&
+                m_producer.nextPi > m_producer.cachedCi)
+            {
+                publish();
+            }
+
+            if (++spins < SPIN_PAUSE_LIMIT)
+            {
+                __builtin_ia32_pause();
+                continue;
+            }
+
+            if (unlikely(LOG_LEVEL_AT_LEAST_WARN(HCL)))
+            {
+                LOG_WARN_RATELIMITTER(HCL,
+                                      1000,  // msec
+                                      "FIFO is still full, name={}",
+                                      m_name);
+            }
+            std::this_thread::yield();
         }
     }
 
-private:
-    const std::string              m_name;
-    std::array<uint32_t, CAPACITY> m_buf;
+    struct alignas(SPSC_FIFO_CACHE_LINE_SIZE) ProducerState
+    {
+        std::atomic<uint64_t> pi {0};         // published data ends here
+        std::atomic<uint64_t> watermark {0};  // end of continuous data before the latest wrap-around
+        uint64_t              nextPi     = 0;  // data is being written from pi to nextPi, published on submit()
+        uint64_t              cachedCi   = 0;  // producer's last view of the consumer index
+        unsigned              batchDepth = 0;
+    };
+
+    struct alignas(SPSC_FIFO_CACHE_LINE_SIZE) ConsumerState
+    {
+        std::atomic<uint64_t> ci {0};
+        uint64_t              cachedPi = 0;  // consumer's last view of the producer index
+    };
+
+    const std::string m_name;
 
-    volatile uint64_t m_ci;
+    ProducerState m_producer;
+    ConsumerState m_consumer;
 
-    volatile uint64_t m_pi;
-    volatile uint64_t m_next_pi;    // data is now being written, from m_pi to m_next_pi. on submit(), m_pi = m_next_pi
-    volatile uint64_t m_watermark;  // signifies the end of continuous data until which the consumer should read.
+    alignas(SPSC_FIFO_CACHE_LINE_SIZE) std::array<uint32_t, CAPACITY> m_buf;
 };
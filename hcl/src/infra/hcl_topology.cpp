@@ -1,18 +1,88 @@
 #include "hcl_topology.h"
-#include "hcl_utils.h"  // for VERIFY
 
-static hwloc_topology_t create_topology()
+#include <mutex>                   // for mutex, lock_guard
+#include <string>                  // for string
+#include <hwloc/export.h>          // for hwloc_topology_export_xmlbuffer
+#include "hcl_utils.h"             // for VERIFY
+#include "infra/hcl_node_cache.h"  // for node_cache
+
+// The topology of this process as XML, exported from the first full discovery or read from the node cache. Later
+// topologies are imported from it, which skips the discovery.
+static std::mutex  s_topologyXmlMutex;
+static std::string s_topologyXml;
+
+static hwloc_topology_t init_topology()
 {
     hwloc_topology_t topology = NULL;
     VERIFY((0 == hwloc_topology_init(&topology)), "Failed to initiate hwloc topology");
-    VERIFY((0 == hwloc_topology_set_flags(topology, HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM)),
-           "Failed to set hwloc topology flags");
     VERIFY((0 == hwloc_topology_set_io_types_filter(topology, HWLOC_TYPE_FILTER_KEEP_ALL)),
            "Failed to set hwloc topology IO types filter");
+    return topology;
+}
+
+static hwloc_topology_t load_topology_from_xml(const std::string& xml)
+{
+    hwloc_topology_t topology = init_topology();
+
+    // The XML describes this machine, binding functions must keep working on it
+    VERIFY((0 == hwloc_topology_set_flags(topology,
+                                          HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM | HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM)),
+           "Failed to set hwloc topology flags");
+    if (hwloc_topology_set_xmlbuffer(topology, xml.c_str(), xml.size() + 1) != 0 || hwloc_topology_load(topology) != 0)
+    {
+        hwloc_topology_destroy(topology);
+        return NULL;
+    }
+
+    return topology;
+}
+
+static hwloc_topology_t discover_topology()
+{
+    hwloc_topology_t topology = init_topology();
+    VERIFY((0 == hwloc_topology_set_flags(topology, HWLOC_TOPOLOGY_FLAG_WHOLE_SYSTEM)),
+           "Failed to set hwloc topology flags");
     VERIFY((0 == hwloc_topology_load(topology)), "Failed to load hwloc topology");
     return topology;
 }
 
+static hwloc_topology_t create_topology()
+{
+    std::lock_guard<std::mutex> lock(s_topologyXmlMutex);
+
+    // XML of another hwloc version may not import the same
+    const std::string cacheEntry = fmt::format("hwloc_topology_{:x}", hwloc_get_api_version());
+
+    if (s_topologyXml.empty())
+    {
+        s_topologyXml = hcl::node_cache::load(cacheEntry).value_or("");
+    }
+
+    if (!s_topologyXml.empty())
+    {
+        if (hwloc_topology_t topology = load_topology_from_xml(s_topologyXml))
+        {
+            return topology;
+        }
+
+        LOG_WARN(HCL, "Failed to import cached hwloc topology, discovering it");
+        s_topologyXml.clear();
+    }
+
+    hwloc_topology_t topology = discover_topology();
+
+    char* xml    = NULL;
+    int   xmlLen = 0;
+    if (hwloc_topology_export_xmlbuffer(topology, &xml, &xmlLen, 0) == 0)
+    {
+        s_topologyXml.assign(xml, xmlLen > 0 ? xmlLen - 1 : 0);  // length includes the terminating null
+        hwloc_free_xmlbuffer(topology, xml);
+        hcl::node_cache::store(cacheEntry, s_topologyXml);
+    }
+
+    return topology;
+}
+
 HwlocTopology::HwlocTopology() : m_topology(create_topology()) {}
 
 HwlocTopology::~HwlocTopology()
@@ -167,6 +167,14 @@ public:
      */
     virtual bool isScaleOutPort(const uint16_t port, const HCL_Comm comm = DEFAULT_COMM_ID) const = 0;
 
+    /**
+     * @brief called from the event queue thread when the link of a port goes down or up
+     *
+     * @param port - port whose link state changed
+     * @param isUp - new link state
+     */
+    virtual void onPortStateChange(const uint32_t port, const bool isUp) {};
+
     HclDeviceConfig&         getDeviceConfig() { return m_deviceConfig; }
     const HclDeviceConfig&   getDeviceConfig() const { return m_deviceConfig; }
     int                      getFd() const;
@@ -24,7 +24,9 @@
 #include "hl_ofi_rdm_component.h"        // for ofi_rdm_component_t
 #include "hl_ofi_param.h"                // for hl_ofi_exclude_tcp_if
 #include "hl_topo.h"
+#include "infra/hcl_node_cache.h"  // for node_cache
 #include <sys/utsname.h>  // for getting kernel version
+#include <unistd.h>       // for access
 
 #define VERBS_PCI_PATH "/sys/class/infiniband/"
 #define PCI_PATH       "/sys/bus/pci/devices/"
@@ -34,6 +36,7 @@ bool ofi_t::s_mrLocal     = false;
 bool ofi_t::s_hmemMR      = false;
 bool ofi_t::s_gaudiDirect = false;
 bool ofi_t::s_verbs       = false;
+bool ofi_t::s_fabricFlush = false;
 
 std::unique_ptr<ofi_plugin_interface> ofi_plugin;
 
@@ -470,16 +473,29 @@ ofi_t::~ofi_t()
 
 bool ofi_t::checkDMABUFSupport()
 {
-    bool    isSupported = false;
-    char*   line        = NULL;
-    size_t  line_size   = 0;
-    ssize_t bytes;
-    FILE*   kallsyms_fd;
+    // Scanning the kernel symbols takes a while. Only support is cached, the symbols may still show up when the RDMA
+    // modules are loaded later in the boot. The entry holds the module exporting the symbol (empty when it is built
+    // into the kernel), support is gone once that module is unloaded, so the cached module must still be loaded.
+    static const std::string         DMABUF_CACHE_ENTRY = "dmabuf_support_module";
+    const std::optional<std::string> cachedModule       = hcl::node_cache::load(DMABUF_CACHE_ENTRY);
+    if (cachedModule && (cachedModule->empty() || access(("/sys/module/" + *cachedModule).c_str(), F_OK) == 0))
+    {
+        LOG_HCL_DEBUG(HCL_OFI, "dmabuf support found in node cache, module '{}'", *cachedModule);
+        return true;
+    }
+
+    bool        isSupported = false;
+    std::string module;
+    char*       line      = NULL;
+    size_t      line_size = 0;
+    ssize_t     bytes;
+    FILE*       kallsyms_fd;
 
     kallsyms_fd = fopen("/proc/kallsyms", "r");
     if (!kallsyms_fd)
     {
         LOG_HCL_ERR(HCL_OFI, "Could not check Linux kernel symbols for dmabuf support.");
+        return false;
     }
 
     while ((bytes = getline(&line, &line_size, kallsyms_fd)) != -1)
@@ -487,12 +503,26 @@ bool ofi_t::checkDMABUFSupport()
         if (strstr(line, "ib_umem_dmabuf_get"))
         {
             isSupported = true;
+
+            // Symbols of a module are listed as "<address> <type> <name>\t[<module>]"
+            const char* moduleStart = strchr(line, '[');
+            const char* moduleEnd   = moduleStart ? strchr(moduleStart, ']') : nullptr;
+            if (moduleEnd)
+            {
+                module.assign(moduleStart + 1, moduleEnd);
+            }
             break;
         }
     }
 
     free(line);
     fclose(kallsyms_fd);
+
+    if (isSupported)
+    {
+        hcl::node_cache::store(DMABUF_CACHE_ENTRY, module);
+    }
+
     return isSupported;
 }
 
@@ -904,12 +934,17 @@ int ofi_t::initOfiComponent(int ofiDevice)
         return hcclLibfabricError;
     }
 
-    int cpuid     = -1;
-    int numa_node = m_gaudi_pci_dev.numa_node;
-    if (numa_node >= 0)
+    // Completions are processed on the NIC's NUMA node
+    int cpuid = -1;
+    if (m_nic_numa_node >= 0)
     {
-        cpuid = get_cpuid_in_numa(numa_node);
+        cpuid = get_cpuid_in_numa(m_nic_numa_node);
     }
+    LOG_HCL_INFO(HCL_OFI,
+                 "OFI component #{} CQ signaling vector cpu {}, NUMA node {}",
+                 ofiDevice,
+                 cpuid,
+                 m_nic_numa_node);
 
     try
     {
@@ -1115,6 +1150,7 @@ int ofi_t::get_ofi_provider(const bool gaudi_direct)
     const std::string providerName = provider.value()->fabric_attr->prov_name;
 
     s_gaudiDirect = gaudi_direct;
+    s_fabricFlush = s_gaudiDirect && GCFG_HCL_FABRIC_FLUSH.value();
     if (s_gaudiDirect)
     {
         LOG_HCL_INFO(HCL_OFI, "Gaudi-direct is enabled, provider {}.", providerName);
@@ -1123,6 +1159,13 @@ int ofi_t::get_ofi_provider(const bool gaudi_direct)
     m_ofi_device = 0;                   // This is always the first one because there is only one in m_providers.
     m_providers  = {provider.value()};  // Only the selected provider saved
 
+    // Host side resources serving the NIC are placed on its NUMA node, falling back to the Gaudi's node
+    m_nic_numa_node = hl_topo::getProviderNumaNode(provider.value());
+    if (m_nic_numa_node < 0)
+    {
+        m_nic_numa_node = m_gaudi_pci_dev.numa_node;
+    }
+
     return hcclSuccess;
 }
 
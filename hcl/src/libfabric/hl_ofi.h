@@ -105,8 +105,9 @@ public:
     static bool     isMRLocal() { return s_mrLocal; }
     static bool     isGaudiDirect() { return s_gaudiDirect; }
     static bool     isVerbs() { return s_verbs; }
-    static bool     isFabricFlush() { return isGaudiDirect() && GCFG_HCL_FABRIC_FLUSH.value(); }
+    static bool     isFabricFlush() { return s_fabricFlush; }
     struct fi_info* get_nic_info(int ofiDevice);
+    int             getNicNumaNode() const { return m_nic_numa_node; }
 
 private:
     /**
@@ -166,6 +167,7 @@ private:
     static bool s_hmemMR;
     static bool s_gaudiDirect;
     static bool s_verbs;
+    static bool s_fabricFlush;
 
     const int                     m_device_fd;
     int                           m_hw_module_id;
@@ -177,4 +179,5 @@ private:
     struct fi_info*               m_fi_getinfo_result;
     std::vector<struct fi_info*>  m_providers;
     PCIE_Device                   m_gaudi_pci_dev;
+    int                           m_nic_numa_node = -1;
 };
@@ -178,6 +178,9 @@ public:
     virtual void* get_cq_buf() = 0;
     virtual int   next_tag(uint64_t* tag) { return 0; }
 
+    // Tag bit that moves a connection's messages to its eager channel, 0 if the component has no spare tag bit
+    virtual uint64_t get_eager_tag_bit() const { return 0; }
+
     virtual int
     listen(uint64_t tag, void* handle, listenComm_t** listenComm, unsigned hostConnIdx, uint16_t qpSetIndex) = 0;
     virtual int
@@ -43,7 +43,7 @@ int ofi_rdm_component_t::next_tag(uint64_t* tag)
 {
     int ret = hcclSuccess;
 
-    if (m_tag + 1 >= m_max_tag)
+    if (m_tag + 1 >= get_eager_tag_bit())
     {
         LOG_HCL_ERR(HCL_OFI, "Can't open more connections for OFI device ID {}", m_ofiDeviceID);
         ret = hcclLibfabricError;
@@ -21,6 +21,9 @@ public:
 
     int next_tag(uint64_t* tag) override;
 
+    // Highest bit below the control bits, connection tags are allocated below it
+    uint64_t get_eager_tag_bit() const override { return (m_max_tag + 1) >> 1; }
+
     int
     listen(uint64_t tag, void* handle, listenComm_t** listenComm, unsigned hostConnIdx, uint16_t qpSetIndex) override;
     int connect(const void* handle,
@@ -7,6 +7,8 @@
 #include <string_view>
 #include <map>
 #include <optional>
+#include <cstring>  // for strerror
+#include <cerrno>   // for errno
 #include <hwloc.h>
 #include <lemon/lp.h>   // for Mip
 #include "hcl_utils.h"  // for VERIFY, LOG_HCL_DEBUG, LOG_H...
@@ -16,6 +18,13 @@ namespace hl_topo
 {
 using namespace lemon;
 
+// The topology does not change while the process runs, so all helpers share one instead of loading their own
+static const HwlocTopology& getTopology()
+{
+    static const HwlocTopology topology;
+    return topology;
+}
+
 static std::string getPCIAddress(const hwloc_obj_t device)
 {
     return fmt::format("{:02x}:{:02x}.{:01x}",
@@ -396,7 +405,7 @@ std::tuple<size_t, std::string> getBestProvider(const std::vector<struct fi_info
 {
     VERIFY(!providers.empty(), "Providers list is empty");
 
-    HwlocTopology topology;
+    const HwlocTopology& topology = getTopology();
     const auto [oams, hnics] = findPciDevices(*topology);
 
     if (oams.empty())
@@ -433,7 +442,7 @@ getProviderInterface(const std::vector<struct fi_info*>& providers)
 {
     VERIFY(!providers.empty(), "Providers list is empty");
 
-    HwlocTopology topology;
+    const HwlocTopology& topology = getTopology();
     const auto [oams, hnics] = findPciDevices(*topology);
     UNUSED(oams);
 
@@ -453,4 +462,86 @@ getProviderInterface(const std::vector<struct fi_info*>& providers)
     return provider_interfaces;
 }
 
+int getProviderNumaNode(const struct fi_info* provider)
+{
+    if (provider == nullptr || provider->nic == nullptr || provider->nic->bus_attr == nullptr ||
+        provider->nic->bus_attr->bus_type != FI_BUS_PCI)
+    {
+        return -1;
+    }
+
+    const struct fi_pci_attr& pci = provider->nic->bus_attr->attr.pci;
+
+    const HwlocTopology& topology = getTopology();
+    const hwloc_obj_t    pciDevice =
+        hwloc_get_pcidev_by_busid(*topology, pci.domain_id, pci.bus_id, pci.device_id, pci.function_id);
+    if (pciDevice == nullptr)
+    {
+        return -1;
+    }
+
+    // IO objects have no nodeset, the closest non-IO ancestor holds the locality of the device
+    const hwloc_obj_t ancestor = hwloc_get_non_io_ancestor_obj(*topology, pciDevice);
+    if (ancestor == nullptr || ancestor->nodeset == nullptr || hwloc_bitmap_weight(ancestor->nodeset) != 1)
+    {
+        // Either unknown or the device is equally close to several nodes
+        return -1;
+    }
+
+    return hwloc_bitmap_first(ancestor->nodeset);
+}
+
+std::vector<uint32_t> getNumaNodeCpus(int numaNode)
+{
+    std::vector<uint32_t> cpus;
+    if (numaNode < 0)
+    {
+        return cpus;
+    }
+
+    const HwlocTopology& topology = getTopology();
+    const hwloc_obj_t    node = hwloc_get_numanode_obj_by_os_index(*topology, numaNode);
+    if (node == nullptr || node->cpuset == nullptr)
+    {
+        return cpus;
+    }
+
+    unsigned cpu;
+    hwloc_bitmap_foreach_begin(cpu, node->cpuset)
+    {
+        cpus.push_back(cpu);
+    }
+    hwloc_bitmap_foreach_end();
+
+    return cpus;
+}
+
+bool bindMemoryToNumaNode(void* addr, size_t length, int numaNode, bool strict)
+{
+    if (numaNode < 0)
+    {
+        return false;
+    }
+
+    const HwlocTopology& topology = getTopology();
+    const hwloc_bitmap_t nodeset  = hwloc_bitmap_alloc();
+    hwloc_bitmap_only(nodeset, numaNode);
+    // Without STRICT hwloc sets a preferred policy on Linux, the kernel falls back to other nodes when this one is full
+    const int rc = hwloc_set_area_membind(*topology,
+                                          addr,
+                                          length,
+                                          nodeset,
+                                          HWLOC_MEMBIND_BIND,
+                                          HWLOC_MEMBIND_BYNODESET | (strict ? HWLOC_MEMBIND_STRICT : 0));
+    const int err = errno;
+    hwloc_bitmap_free(nodeset);
+
+    if (rc != 0)
+    {
+        LOG_WARN(HCL, "Failed to bind host memory to NUMA node {}, errno={} ({})", numaNode, err, std::strerror(err));
+        return false;
+    }
+    return true;
+}
+
 }  // namespace hl_topo
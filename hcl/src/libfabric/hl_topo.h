@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t
 #include <vector>         // for std::vector
 #include <string>         // for std::string
 #include <unordered_map>  // for std::unordered_map
@@ -27,4 +29,32 @@ std::tuple<size_t, std::string> getBestProvider(const std::vector<struct fi_info
 std::unordered_map<const struct fi_info*, std::string>
 getProviderInterface(const std::vector<struct fi_info*>& providers);
 
+/**
+ * @brief Find the NUMA node the provider's NIC is attached to.
+ *
+ * @param provider hnic provider
+ * @return OS index of the NIC's NUMA node, or -1 if it can't be determined
+ */
+int getProviderNumaNode(const struct fi_info* provider);
+
+/**
+ * @brief Find the CPUs of a NUMA node.
+ *
+ * @param numaNode OS index of the NUMA node
+ * @return OS indexes of the node's CPUs, empty if the node is unknown
+ */
+std::vector<uint32_t> getNumaNodeCpus(int numaNode);
+
+/**
+ * @brief Bind the physical pages backing a memory area to a NUMA node.
+ * Must be called before the area is first touched.
+ *
+ * @param addr start of the area
+ * @param length length of the area in bytes
+ * @param numaNode OS index of the NUMA node
+ * @param strict only allocate on the node, otherwise it is preferred and other nodes are used when it is full
+ * @return true if the binding was applied
+ */
+bool bindMemoryToNumaNode(void* addr, size_t length, int numaNode, bool strict);
+
 }  // namespace hl_topo
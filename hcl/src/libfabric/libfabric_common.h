@@ -25,13 +25,15 @@ inline int post_send(ofiComm_t*             ofiComm,
                      ofi_req_t**            req,
                      ofi_t*                 g_ofi,
                      OfiCompCallbackParams& compParams,
+                     struct fid_mr*         mr_desc   = NULL,
                      bool                   mr_lookup = true)
 {
     int            ret       = hcclSuccess;
     ofi_req_t*     request   = NULL;
-    struct fid_mr* mr_handle = NULL;
+    struct fid_mr* mr_handle = mr_desc;
 
-    if (mr_lookup)
+    // A buffer registered by the caller is sent with its own descriptor
+    if (mr_lookup && mr_handle == NULL)
     {
         // Both gaudi-direct and native verbs provider require MR_LOCAL
         if (ofi_t::isMRLocal())
@@ -80,13 +82,15 @@ inline int post_recv(ofiComm_t*             ofiComm,
                      ofi_req_t**            req,
                      ofi_t*                 g_ofi,
                      OfiCompCallbackParams& compParams,
+                     struct fid_mr*         mr_desc   = NULL,
                      bool                   mr_lookup = true)
 {
     int            ret       = hcclSuccess;
     ofi_req_t*     request   = NULL;
-    struct fid_mr* mr_handle = NULL;
+    struct fid_mr* mr_handle = mr_desc;
 
-    if (mr_lookup)
+    // A buffer registered by the caller is received with its own descriptor
+    if (mr_lookup && mr_handle == NULL)
     {
         // Both gaudi-direct and native verbs provider require MR_LOCAL
         if (ofi_t::isMRLocal())
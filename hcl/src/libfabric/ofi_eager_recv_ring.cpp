@@ -0,0 +1,152 @@
+#include "libfabric/ofi_eager_recv_ring.h"
+
+#include <cstring>  // for memcpy
+
+#include "hcl_utils.h"                   // for LOG_HCL_ERR, LOG_HCL_DEBUG
+#include "libfabric/hl_ofi.h"            // for ofi_t
+#include "libfabric/libfabric_common.h"  // for post_recv
+
+EagerRecvRing::EagerRecvRing(ofi_t* ofi, const ofiComm_t& eagerComm) : m_ofi(ofi), m_comm(eagerComm)
+{
+    m_comm.num_inflight_sends = 0;
+    m_comm.num_inflight_recvs = 0;
+}
+
+EagerRecvRing::~EagerRecvRing()
+{
+    destroy();
+}
+
+void EagerRecvRing::destroy()
+{
+    // The eager tag is never reused once the connection is gone, so the slots still posted can no longer match a
+    // message. Their requests are not reaped by the provider and are freed here.
+    for (Slot* slot : m_posted)
+    {
+        delete slot->req;
+    }
+    m_posted.clear();
+
+    if (m_mr != nullptr && ofi_component_t::deregister_mr(m_mr) != 0)
+    {
+        LOG_HCL_ERR(HCL, "Failed to deregister eager recv slots MR of tag {}", m_comm.tag);
+    }
+    m_mr = nullptr;
+}
+
+bool EagerRecvRing::init(const size_t slotSize, const unsigned slotCount)
+{
+    m_slotSize = slotSize;
+    m_buffer.resize(slotSize * slotCount);
+
+    if (ofi_t::isMRLocal())
+    {
+        ofi_component_t* component = m_ofi->getOfiComponent(m_comm.dev);
+        if (component->register_mr(m_buffer.data(), m_buffer.size(), FI_HMEM_SYSTEM, 0, &m_mr) != 0)
+        {
+            LOG_HCL_ERR(HCL, "Failed to register eager recv slots of tag {}", m_comm.tag);
+            m_mr = nullptr;
+            return false;
+        }
+    }
+
+    m_slots.resize(slotCount);
+    for (unsigned i = 0; i < slotCount; ++i)
+    {
+        m_slots[i] = {m_buffer.data() + i * slotSize, nullptr};
+        if (!postSlot(m_slots[i]))
+        {
+            return false;
+        }
+    }
+
+    LOG_HCL_DEBUG(HCL, "Eager recv slots of tag {}: count={}, size={}", m_comm.tag, slotCount, slotSize);
+    return true;
+}
+
+bool EagerRecvRing::postSlot(Slot& slot)
+{
+    // Slots complete through the ring, not through a callback of their own
+    OfiCompCallbackParams noCallback;
+    noCallback.compCallBack = nullptr;
+
+    if (post_recv(&m_comm, slot.buffer, m_slotSize, &slot.req, m_ofi, noCallback, m_mr, false) != 0)
+    {
+        LOG_HCL_ERR(HCL, "Failed to post eager recv slot of tag {}", m_comm.tag);
+        slot.req = nullptr;
+        return false;
+    }
+
+    m_posted.push_back(&slot);
+    return true;
+}
+
+bool EagerRecvRing::post(void* recvBuffer, size_t size, const OfiCompCallbackParams& compParams, uint64_t& seq)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    seq = m_frontSeq + m_pending.size();
+    m_pending.push_back({recvBuffer, size, compParams});
+
+    return drain();
+}
+
+bool EagerRecvRing::test(const uint64_t seq, int& done)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const bool ok = drain();
+    done          = (!ok || seq < m_frontSeq) ? 1 : 0;
+    return ok;
+}
+
+bool EagerRecvRing::drain()
+{
+    // Messages complete in the order their slots were posted, a later slot is not consumed before an earlier one
+    while (!m_pending.empty() && !m_posted.empty())
+    {
+        Slot*  slot     = m_posted.front();
+        int    done     = 0;
+        size_t received = 0;
+        if (m_ofi->test(slot->req, &done, &received) != 0)
+        {
+            LOG_HCL_ERR(HCL, "Eager recv slot of tag {} completed with an error", m_comm.tag);
+            slot->req = nullptr;
+            m_posted.pop_front();
+            return false;
+        }
+        if (!done)
+        {
+            return true;
+        }
+        slot->req = nullptr;
+        m_posted.pop_front();
+
+        PendingRecv& recv = m_pending.front();
+        if (received > recv.size)
+        {
+            LOG_HCL_ERR(HCL,
+                        "Eager message {} of tag {} has {} bytes, recv expects {}",
+                        m_frontSeq,
+                        m_comm.tag,
+                        received,
+                        recv.size);
+            return false;
+        }
+
+        std::memcpy(recv.buffer, slot->buffer, received);
+        if (recv.compParams.compCallBack)
+        {
+            recv.compParams.compCallBack(&recv.compParams);
+        }
+        m_pending.pop_front();
+        m_frontSeq++;
+
+        if (!postSlot(*slot))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
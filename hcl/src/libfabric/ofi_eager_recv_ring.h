@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t, uint64_t
+#include <deque>    // for deque
+#include <mutex>    // for mutex
+#include <vector>   // for vector
+
+#include "libfabric/hl_ofi_component.h"  // for ofiComm_t, ofi_req_t, OfiCompCallbackParams
+
+class ofi_t;
+
+/**
+ * Receive slots preposted on the eager channel of one connection.
+ *
+ * The sender sends every message up to the slot size on the connection's eager tag, so it lands in a slot that is
+ * already posted instead of waiting for the matching recv to be posted or in the provider's unexpected buffers.
+ * Messages on a tag are matched to the posted slots in post order, so the n-th eager message of the connection is in
+ * the n-th posted slot. A recv takes the next message number, and once both its slot completed and the recv was
+ * posted the payload is copied to the recv buffer, the recv's completion callback is called and the slot is reposted
+ * at the back. Messages beyond the posted slots wait in the provider until a slot is reposted.
+ *
+ * post() is called by the thread posting the recvs and test() by the thread reaping them, possibly concurrently.
+ */
+class EagerRecvRing
+{
+public:
+    /**
+     * @param ofi - ofi instance of the connection
+     * @param eagerComm - receive side of the connection on its eager tag, copied into the ring
+     */
+    EagerRecvRing(ofi_t* ofi, const ofiComm_t& eagerComm);
+    ~EagerRecvRing();
+
+    EagerRecvRing(const EagerRecvRing&)            = delete;
+    EagerRecvRing& operator=(const EagerRecvRing&) = delete;
+
+    /**
+     * @brief allocate and register the slots and prepost all of them
+     * @return false if the slots could not be registered or posted
+     */
+    bool init(size_t slotSize, unsigned slotCount);
+
+    /**
+     * @brief take the next eager message of the connection for a recv, completing it right away if it already arrived
+     * @param seq - message number of the recv, to test it with
+     * @return false on a failure to complete or repost a slot
+     */
+    bool post(void* recvBuffer, size_t size, const OfiCompCallbackParams& compParams, uint64_t& seq);
+
+    /**
+     * @brief non blocking check whether the recv of a message number was completed
+     * @return false on a failure to complete or repost a slot
+     */
+    bool test(uint64_t seq, int& done);
+
+    size_t getSlotSize() const { return m_slotSize; }
+
+private:
+    struct Slot
+    {
+        uint8_t*   buffer;
+        ofi_req_t* req;
+    };
+
+    struct PendingRecv
+    {
+        void*                 buffer;
+        size_t                size;
+        OfiCompCallbackParams compParams;
+    };
+
+    bool postSlot(Slot& slot);
+    bool drain();
+    void destroy();
+
+    ofi_t*         m_ofi;
+    ofiComm_t      m_comm;
+    size_t         m_slotSize = 0;
+    struct fid_mr* m_mr       = nullptr;
+
+    std::vector<uint8_t> m_buffer;
+    std::vector<Slot>    m_slots;
+
+    // Under m_mutex: posted slots in post order, the first holds message m_frontSeq, and the recvs of the messages
+    // from m_frontSeq on, in message order
+    std::mutex              m_mutex;
+    std::deque<Slot*>       m_posted;
+    std::deque<PendingRecv> m_pending;
+    uint64_t                m_frontSeq = 0;
+};
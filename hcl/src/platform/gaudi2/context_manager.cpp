@@ -34,7 +34,9 @@ getReductionOpcode(HCL_CollectiveOp collectiveOp, hcclRedOp_t reduceOp, hcclData
         {hcclUint32, REDUCTION_UINT32},
         {hcclBfloat16, REDUCTION_UPSCALING_BF16},
         {hcclFloat16, REDUCTION_UPSCALING_FP16},
-        {hcclFloat32, REDUCTION_FP32}
+        {hcclFloat32, REDUCTION_FP32},
+        {hcclFp8E4M3, REDUCTION_UINT8},  // FP8 is never reduced, only moved
+        {hcclFp8E5M2, REDUCTION_UINT8}
     };
 
     g2_nic_engine_reduction_opcode_t result = {.raw = 0};
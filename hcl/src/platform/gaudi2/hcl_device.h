@@ -55,6 +55,9 @@ public:
 
     virtual void updateDisabledPorts() override;
 
+    // The FW takes the scale-out ports from the scale-out global contexts, which are only sent at device init
+    virtual bool isScaleOutPortsRebalanceSupported() const override { return false; }
+
     virtual spHclNic allocateNic(uint32_t nic, uint32_t max_qps) override;
 
 protected:
@@ -54,13 +54,12 @@ public:
 protected:
     Gaudi3BaseRuntimeConnectivity& getGaudi3BasedRunTimeConnectivity(const HCL_Comm hclCommId)
     {
-        return (*(dynamic_cast<Gaudi3BaseRuntimeConnectivity*>(m_commsRuntimeConnectivity[DEFAULT_COMM_ID].get())));
+        return (*(dynamic_cast<Gaudi3BaseRuntimeConnectivity*>(&getRuntimeConnectivity(hclCommId))));
     };
 
     const Gaudi3BaseRuntimeConnectivity& getGaudi3BasedRunTimeConnectivityConst(const HCL_Comm hclCommId) const
     {
-        return (
-            *(dynamic_cast<const Gaudi3BaseRuntimeConnectivity*>(m_commsRuntimeConnectivity[DEFAULT_COMM_ID].get())));
+        return (*(dynamic_cast<const Gaudi3BaseRuntimeConnectivity*>(&getRuntimeConnectivity(hclCommId))));
     };
 
     const uint32_t getRemoteDevicePortMask(const uint32_t moduleId, HclDynamicCommunicator& dynamicComm);
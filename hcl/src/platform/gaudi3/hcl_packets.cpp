@@ -100,7 +100,9 @@ static inline g3_nic_engine_reduction_opcode_t getReductionOpcode(HCL_Collective
         {hcclUint32, REDUCTION_UINT32},
         {hcclBfloat16, REDUCTION_UPSCALING_BF16},
         {hcclFloat16, REDUCTION_UPSCALING_FP16},
-        {hcclFloat32, REDUCTION_FP32}
+        {hcclFloat32, REDUCTION_FP32},
+        {hcclFp8E4M3, REDUCTION_UINT8},  // FP8 is never reduced, only moved
+        {hcclFp8E5M2, REDUCTION_UINT8}
     };
 
     g3_nic_engine_reduction_opcode_t result = {.raw = 0};
@@ -622,12 +622,22 @@ uint32_t QPManagerGaudi3ScaleOut::getQPi(const QPManagerHints& hints) const
 
 void QPManagerGaudi3ScaleOut::closeQPs(const QPManagerHints& hints)
 {
-    const HCL_Comm            comm  = hints.m_comm;
-    const UniqueSortedVector& ranks = m_device.getComm(comm).getOuterRanksExclusive();
+    const HCL_Comm comm = hints.m_comm;
 
     // in HNIC flows we do not open or register scaleout QPs, so do not need to close any
     if (m_qpInfoScaleOut.size() == 0) return;
 
+    // a remote rank in the hints closes only its QPs, e.g. when the communicator reconnects its scale-out
+    UniqueSortedVector ranks;
+    if (hints.m_remoteRank != HCL_INVALID_RANK)
+    {
+        ranks.insert_sorted(hints.m_remoteRank);
+    }
+    else
+    {
+        ranks = m_device.getComm(comm).getOuterRanksExclusive();
+    }
+
     for (auto& rank : ranks)
     {
         for (unsigned qpSet = 0; qpSet < MAX_QPS_SETS_PER_CONNECTION; qpSet++)
@@ -0,0 +1,47 @@
+#include "platform/gen2_arch_common/all2all_schedule.h"
+
+#include <algorithm>  // for shuffle
+#include <numeric>    // for iota
+#include <random>     // for mt19937
+
+All2AllBoxSchedule buildAll2AllSchedule(All2AllScheduleType type, unsigned myBox, unsigned numBoxes, uint64_t seed)
+{
+    All2AllBoxSchedule schedule;
+    schedule.sendBox.resize(numBoxes);
+    schedule.recvBox.resize(numBoxes);
+    schedule.sendIter.resize(numBoxes, numBoxes);
+    schedule.recvIter.resize(numBoxes, numBoxes);
+
+    if (type == All2AllScheduleType::XOR)
+    {
+        for (unsigned boxIter = 0; boxIter < numBoxes; boxIter++)
+        {
+            schedule.sendBox[boxIter] = myBox ^ boxIter;
+            schedule.recvBox[boxIter] = myBox ^ boxIter;
+        }
+    }
+    else
+    {
+        // All ranks shuffle with the same seed, so every box agrees on the shift used by each iteration
+        std::vector<unsigned> shifts(numBoxes);
+        std::iota(shifts.begin(), shifts.end(), 0);
+        if (type == All2AllScheduleType::RANDOM && numBoxes > 1)
+        {
+            std::mt19937 generator(seed);
+            std::shuffle(shifts.begin() + 1, shifts.end(), generator);
+        }
+        for (unsigned boxIter = 0; boxIter < numBoxes; boxIter++)
+        {
+            schedule.sendBox[boxIter] = (myBox + shifts[boxIter]) % numBoxes;
+            schedule.recvBox[boxIter] = (myBox + numBoxes - shifts[boxIter]) % numBoxes;
+        }
+    }
+
+    for (unsigned boxIter = 0; boxIter < numBoxes; boxIter++)
+    {
+        if (schedule.sendBox[boxIter] < numBoxes) schedule.sendIter[schedule.sendBox[boxIter]] = boxIter;
+        if (schedule.recvBox[boxIter] < numBoxes) schedule.recvIter[schedule.recvBox[boxIter]] = boxIter;
+    }
+
+    return schedule;
+}
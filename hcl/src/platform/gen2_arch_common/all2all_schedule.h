@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>  // for uint64_t
+#include <vector>   // for vector
+
+// Scaleout peer order of All2All box iterations (HCL_ALL2ALL_SCHEDULE)
+enum class All2AllScheduleType
+{
+    SHIFT  = 0,  // boxIter i: send to myBox + i, recv from myBox - i
+    XOR    = 1,  // boxIter i: pairwise exchange with myBox ^ i (power of 2 boxes only)
+    RANDOM = 2,  // shifted exchange, the order of the shifts is shuffled per collective
+};
+
+// Per collective mapping between box iterations and remote boxes, shared by all the slice states of a collective.
+// Iteration 0 is always my own box.
+struct All2AllBoxSchedule
+{
+    std::vector<unsigned> sendBox;   // indexed by boxIter
+    std::vector<unsigned> recvBox;   // indexed by boxIter
+    std::vector<unsigned> sendIter;  // indexed by box
+    std::vector<unsigned> recvIter;  // indexed by box
+};
+
+/**
+ * @brief build the box iteration order of one box.
+ *
+ * Every box builds its own schedule, and at each iteration the box a schedule sends to receives from the box that
+ * built it. The schedule depends only on its arguments, so the schedules of all boxes can be checked offline.
+ *
+ * @param type - XOR requires a power of 2 numBoxes
+ * @param myBox - the box the schedule is built for
+ * @param numBoxes - box iterations of the collective
+ * @param seed - shuffles the RANDOM schedule, has to be identical on all boxes
+ * @return the schedule, boxes not visited have iteration numBoxes
+ */
+All2AllBoxSchedule
+buildAll2AllSchedule(All2AllScheduleType type, unsigned myBox, unsigned numBoxes, uint64_t seed);
@@ -37,6 +37,8 @@ public:
     hcclResult_t addGroupStart();
     hcclResult_t addGroupEnd();
 
+    bool inGroup() const { return m_counter > 0; }
+
 protected:
     void onHandleSendRecvEntry(SendRecvApiEntry& entry);
     void handleSelfSendRecv();
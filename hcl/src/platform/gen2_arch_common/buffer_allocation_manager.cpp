@@ -47,16 +47,19 @@ unsigned BufferAllocationManager::alloc(DeviceBufferManager&                devi
             VERIFY(!m_allocations[bufferAllocationIndex].dontWaitOnCg, "LTU only supports up buffer pool!");
         }
 
+        bool stalled = false;
         if (lastTargetVal != 0)
         {
             VERIFY(longSo.targetValue > lastTargetVal,
                    "No Available intermediate buffer");  // Check if lastTargetVal < 0
             signalsDiff = longSo.targetValue - lastTargetVal;
-            if ((cgSize - signalsDiff) > 0 && (cgSize - signalsDiff) > requiredExtraCredits)
+            stalled     = (cgSize - signalsDiff) > 0;
+            if (stalled && (cgSize - signalsDiff) > requiredExtraCredits)
             {
                 requiredExtraCredits = (unsigned)(cgSize - signalsDiff);
             }
         }
+        deviceBufferManager.recordAllocation(m_allocations[bufferAllocationIndex].m_poolId, stalled);
         LOG_TRACE(HCL_ECR,
                   "IMB allocation: pool {}, iterations {}, current so {}, required extra credits {}",
                   m_allocations[bufferAllocationIndex].m_poolId,
@@ -4,7 +4,6 @@
 #include <algorithm>  // for max
 #include <cstdint>
 
-#include "hcl_global_conf.h"  // for GCFG_*
 #include "platform/gen2_arch_common/types.h"
 #include "hcl_api_types.h"
 #include "hcl_dynamic_communicator.h"
@@ -31,7 +30,6 @@ CommonState::CommonState(HclCollectiveParams& other,
                          SignalsCalculator&   signalsCalculator,
                          RemainderCalculator* remainderCalculator)
 : HclCollectiveParams(other),
-  m_hnicQpSprayThreshold(GCFG_HCL_HNIC_QP_SPRAY_THRESHOLD.value()),
   m_rootBox(m_root == HCL_INVALID_RANK ? (unsigned)-1 : m_dynamicComm.getRankToScaleupGroupMap()[m_root]),
   m_isMultiScaleupGroup(m_dynamicComm.isCommunicatorMultiScaleupGroup()),
   m_isRoot(m_root == m_dynamicComm.getMyRank()),
@@ -44,16 +42,17 @@ CommonState::CommonState(HclCollectiveParams& other,
   m_dataTypeSizeInBytes(dataTypeSizeInBytes(m_dataType)),
   m_intermediateBufferManager(intermediateBufferManager),
   m_remainderCalculator(remainderCalculator),
-  m_boxType((HclConfigType)GCFG_BOX_TYPE_ID.value()),
+  m_boxType(m_dynamicComm.getConfig().boxType),
   m_maxNumScaleUpPortsPerConnection(maxNumScaleUpPortsPerConnection),
   m_signalsCalculator(&signalsCalculator)
 {
-    initCollectiveOp(GCFG_HCL_IS_SINGLE_PEER_BROADCAST_ALLOWED.value());
+    initCollectiveOp(m_dynamicComm.getConfig().singlePeerBroadcastAllowed);
 
     checkInPlaceOp();
     setIsReductionCollective();
     check16BitReductionOp();
     checkHierarchicalOp();
+    calcAll2AllSchedule();
     calcMaxSliceCounts();
     calcScaleoutLongterm();
 
@@ -264,6 +263,13 @@ bool CommonState::isEdgeIteration() const
 
 unsigned CommonState::calcBoxIterRecv(BoxNumInfo& boxNumInfo) const
 {
+    if (m_all2allSchedule)
+    {
+        return boxNumInfo.m_orientation == BoxNumInfo::boxOrientation::NEXT_BOX
+                   ? m_all2allSchedule->sendIter[boxNumInfo.m_boxNum]
+                   : m_all2allSchedule->recvIter[boxNumInfo.m_boxNum];
+    }
+
     unsigned boxIter = m_boxIterations + m_dynamicComm.getMyScaleupGroup() - boxNumInfo.m_boxNum;
     if (boxIter >= m_boxIterations)
     {
@@ -359,12 +365,13 @@ void CommonState::initCollectiveOp(const bool singlePeerBroadcastAllowed)
 {
     if (m_collectiveOp == eHCLBroadcast)
     {
-        if ((m_count * m_dataTypeSizeInBytes) <= GCFG_HCL_COMPLEX_BCAST_MIN_SIZE.value() ||
+        if ((m_count * m_dataTypeSizeInBytes) <= m_dynamicComm.getConfig().complexBcastMinSize ||
             m_dynamicComm.getScaleupGroupSize() <= 2)
         {
             m_collectiveOp = eHCLSimpleBroadcast;
         }
-        else if (singlePeerBroadcastAllowed && (GCFG_HCL_USE_SINGLE_PEER_BROADCAST.value() || !m_isMultiScaleupGroup))
+        else if (singlePeerBroadcastAllowed &&
+                 (m_dynamicComm.getConfig().useSinglePeerBroadcast || !m_isMultiScaleupGroup))
         {
             m_collectiveOp = eHCLSinglePeerBroadcast;
         }
@@ -663,7 +670,7 @@ void CommonState::calcMaxSliceCounts()
 uint32_t CommonState::getNumSlices(uint64_t totalRankCount, uint32_t numRanks)
 {
     uint32_t originalBufferCount = (uint32_t)m_optimalBufferCount;
-    uint32_t minBufferCount      = (uint32_t)div(m_optimalBufferCount, GCFG_HCL_MIN_IMB_SIZE_FACTOR.value());
+    uint32_t minBufferCount      = (uint32_t)div(m_optimalBufferCount, m_dynamicComm.getConfig().minImbSizeFactor);
     uint32_t minSlices           = div_round_up(totalRankCount, m_optimalBufferCount);
     uint32_t maxSlices           = minSlices + MAX_NUM_SLICES_SEARCH;
     ;
@@ -970,7 +977,7 @@ void CommonState::calcScaleoutLongterm()
 void CommonState::determineSyncUpBufferWithLtu()
 {
     m_syncUpBufferWithLtu = m_isMultiScaleupGroup && m_currentOp == eHCLReduceScatter &&
-                            (!isHostNic() || (isGDR() && GCFG_HCL_HNIC_LTU.value())) &&
+                            (!isHostNic() || (isGDR() && m_dynamicComm.getConfig().hnicLtu)) &&
                             m_dynamicComm.getScaleupGroupSize() > 1;
 }
 
@@ -992,6 +999,70 @@ void CommonState::checkHierarchicalOp()
     m_boxIterations = div((uint32_t)m_dynamicComm.m_commSize, (uint32_t)m_dynamicComm.getScaleupGroupSize());
 }
 
+void CommonState::calcAll2AllSchedule()
+{
+    All2AllScheduleType type = (All2AllScheduleType)m_dynamicComm.getConfig().all2allSchedule;
+    if (m_collectiveOp != eHCLAll2All || m_boxIterations <= 2 || type == All2AllScheduleType::SHIFT)
+    {
+        return;
+    }
+
+    if (type == All2AllScheduleType::XOR && !isPowerOf2(m_boxIterations))
+    {
+        LOG_HCL_DEBUG(HCL, "XOR all2all schedule requires power of 2 boxes ({}), using shifted schedule", m_boxIterations);
+        return;
+    }
+
+    const unsigned                      numBoxes = m_boxIterations;
+    const unsigned                      myBox    = m_dynamicComm.getMyScaleupGroup();
+    std::shared_ptr<All2AllBoxSchedule> schedule = std::make_shared<All2AllBoxSchedule>(buildAll2AllSchedule(
+        type,
+        myBox,
+        numBoxes,
+        m_dynamicComm.getConfig().all2allScheduleSeed + m_dynamicComm.getCollectiveCtr()));
+
+    // every box has to be visited exactly once in each direction, starting with my own box
+    VERIFY(schedule->sendBox[0] == myBox && schedule->recvBox[0] == myBox, "all2all schedule must start at my box");
+    for (unsigned box = 0; box < numBoxes; box++)
+    {
+        VERIFY(schedule->sendIter[box] < numBoxes && schedule->recvIter[box] < numBoxes,
+               "all2all schedule {} does not cover box {}",
+               (unsigned)type,
+               box);
+    }
+
+    m_all2allSchedule = schedule;
+}
+
+unsigned CommonState::getNextBoxForIter(unsigned boxIter) const
+{
+    if (m_all2allSchedule)
+    {
+        return m_all2allSchedule->sendBox[boxIter];
+    }
+    return mod(m_dynamicComm.getMyScaleupGroup() + boxIter, m_boxIterations);
+}
+
+unsigned CommonState::getPrevBoxForIter(unsigned boxIter) const
+{
+    if (m_all2allSchedule)
+    {
+        return m_all2allSchedule->recvBox[boxIter];
+    }
+    return mod(m_boxIterations + (int)m_dynamicComm.getMyScaleupGroup() - (int)boxIter, m_boxIterations);
+}
+
+bool CommonState::isLastBoxIter(BoxNumInfo& boxNumInfo, bool isSend) const
+{
+    if (m_all2allSchedule)
+    {
+        const std::vector<unsigned>& iters = isSend ? m_all2allSchedule->sendIter : m_all2allSchedule->recvIter;
+        return iters[boxNumInfo.m_boxNum] + 1 == m_boxIterations;
+    }
+    return (isSend ? getNextBox(boxNumInfo.m_boxNum, m_boxIterations)
+                   : getPrevBox(boxNumInfo.m_boxNum, m_boxIterations)) == m_dynamicComm.getMyScaleupGroup();
+}
+
 bool CommonState::isScaleoutRequired(bool isSend, BoxNumInfo& sendBoxNumInfo)
 {
     // no scaleout on first box iteration
@@ -1082,10 +1153,9 @@ void CommonState::calcSliceQpSet(const unsigned sliceIter)
 {
     /* Params used to calculate m_qpSet, should be symmetric between ranks */
 
-    const auto transactionSize = m_rankScaleOutCount * m_dataTypeSizeInBytes;
-    m_qpSet                    = (m_isHostNic && (transactionSize <= m_hnicQpSprayThreshold))
-                                     ? 0  // Use only the first qpSet below threshold
-                                     : mod(m_dynamicComm.getCollectiveCtr() + sliceIter, m_dynamicComm.getMaxScaleOutQpSetsNum());
+    const uint64_t transactionSize = m_rankScaleOutCount * m_dataTypeSizeInBytes;
+    const unsigned numQpSets       = m_dynamicComm.getScaleOutQpSetsNum(transactionSize);
+    m_qpSet                        = mod(m_dynamicComm.getCollectiveCtr() + sliceIter, numQpSets);
 }
 
 unsigned CommonState::getBroadcastScatterOpBoxIterations() const
@@ -1127,9 +1197,7 @@ SliceState::SliceState(const CommonState&   commonState,
     if (!m_isMultiScaleupGroup) return;
 
     m_isHierarchicalFirst = (m_boxNumInfo.m_boxNum == m_dynamicComm.getMyScaleupGroup());
-    m_isHierarchicalLast =
-        ((m_isSend ? getNextBox(m_boxNumInfo.m_boxNum, m_boxIterations)
-                   : getPrevBox(m_boxNumInfo.m_boxNum, m_boxIterations)) == m_dynamicComm.getMyScaleupGroup());
+    m_isHierarchicalLast  = isLastBoxIter(m_boxNumInfo, m_isSend);
 
     m_execution.m_deviceCount = m_boxStrideCount;
     m_execution.m_cellCount   = m_rankScaleOutCount;
@@ -1365,5 +1433,6 @@ bool NonCollectiveState::isScaleOutRequired() const
 void NonCollectiveState::calcSliceQpSet(const unsigned sliceIter)
 {
     /* Params used to calculate m_qpSet, should be symmetric between ranks */
-    m_qpSet = mod(sliceIter, m_dynamicComm.getMaxScaleOutQpSetsNum());
+    const uint64_t transactionSize = m_execution.m_deviceCount * dataTypeSizeInBytes(m_dataType);
+    m_qpSet                        = mod(sliceIter, m_dynamicComm.getScaleOutQpSetsNum(transactionSize));
 }
@@ -2,6 +2,8 @@
 
 #include <cstddef>                  // for size_t
 #include <cstdint>                  // for uint64_t, uint8_t
+#include <memory>                   // for shared_ptr
+#include <vector>                   // for vector
 #include "hcl_api_types.h"          // for HCL_CollectiveOp
 #include "hcl_collective_params.h"  // for HclCollectiveP...
 #include "llvm/small_vector.h"      // for SmallVector
@@ -10,6 +12,8 @@
 #include "infra/scal/gen2_arch_common/scal_types.h"           // for HOST_FENCES_NR
 #include "hcl_types.h"                                        // for HclConfigType
 #include "platform/gen2_arch_common/device_buffer_manager.h"  // for e_devicePoolID
+#include "infra/hcl_latency_stats.h"                          // for CollectiveLatencyStats
+#include "platform/gen2_arch_common/all2all_schedule.h"       // for All2AllBoxSchedule
 
 // fwd decl
 class HclAddressGenerator;
@@ -100,6 +104,7 @@ public:
     void determineSyncUpBufferWithLtu();
 
     void checkHierarchicalOp();
+    void calcAll2AllSchedule();
 
     bool     isRemainderAllowedForCollective() const;
     bool     isComplexImplementation() const;
@@ -121,7 +126,6 @@ public:
 
     uint64_t getIntermediateBuffer(e_devicePoolID poolIndex);
 
-    const uint64_t m_hnicQpSprayThreshold;
     uint64_t       m_rankScaleUpCount;
     uint64_t       m_scaleUpStrideCount;
     uint64_t       m_boxCount;
@@ -137,6 +141,14 @@ public:
     unsigned m_all2allIterations      = 1;
     uint64_t m_all2allIterStrideCount = 0;
 
+    // Host time spent in each phase of the call, accumulated only when latency stats are enabled
+    CollectiveLatencyStats::PhaseLatencies* getPhaseLatencies()
+    {
+        return m_measureLatency ? &m_phaseLatencies : nullptr;
+    }
+    CollectiveLatencyStats::PhaseLatencies m_phaseLatencies = {};
+    bool                                   m_measureLatency = false;
+
     bool     m_inPlace                = false;
     bool     m_16BitReduction         = false;
     bool     m_isMultiScaleupGroup    = false;
@@ -195,6 +207,12 @@ public:
     bool     isEdgeIteration(BoxNumInfo& boxNumInfo) const;
     bool     isEdgeIteration() const;
     unsigned calcBoxIterRecv(BoxNumInfo& boxNumInfo) const;
+    unsigned getNextBoxForIter(unsigned boxIter) const;
+    unsigned getPrevBoxForIter(unsigned boxIter) const;
+    bool     isLastBoxIter(BoxNumInfo& boxNumInfo, bool isSend) const;
+
+    // null when the default shifted schedule is used
+    std::shared_ptr<const All2AllBoxSchedule> m_all2allSchedule;
 
     unsigned getBroadcastScatterOpBoxIterations() const;
     uint64_t calculateCUID(bool isFirstBox, bool isLastBox);
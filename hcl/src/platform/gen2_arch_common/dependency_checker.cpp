@@ -90,9 +90,17 @@ uint64_t DependencyChecker::checkDependency(DataOperationFlow         operationF
                                             uint64_t                  address,
                                             uint64_t                  size,
                                             uint64_t                  targetValue,
-                                            bool                      dbModificationIsAllowed)
+                                            bool                      dbModificationIsAllowed,
+                                            uint64_t                  collectiveStartTargetValue)
 {
     uint64_t rcTargetValue = 0;
+
+    // ranges registered by the current collective are not a dependency of itself
+    auto isOwnRange = [&](uint64_t rangeTargetValue) {
+        return collectiveStartTargetValue == 0 ? rangeTargetValue == targetValue
+                                               : rangeTargetValue > collectiveStartTargetValue;
+    };
+
     // when we only check for dependencies without updating the db, we should be as strict as possible.
     if (!dbModificationIsAllowed) operationFlow = DataOperationFlow::READ_AFTER_WRITE;
 
@@ -183,7 +191,7 @@ uint64_t DependencyChecker::checkDependency(DataOperationFlow         operationF
                 // inside group context, we should merge only ranges with the same target value as the this new range.
                 address         = std::min(address, it->first);
                 firstAddressEnd = std::max(firstAddressEnd, it->second.m_endAddress);
-                if (it->second.m_targetValue != targetValue)
+                if (!isOwnRange(it->second.m_targetValue))
                 {
                     rcTargetValue = std::max(rcTargetValue, it->second.m_targetValue);
                 }
@@ -193,7 +201,7 @@ uint64_t DependencyChecker::checkDependency(DataOperationFlow         operationF
         {
             for (std::map<uint64_t, DeviceBufferRange>::iterator it = itFirst; it != std::next(itLast); it++)
             {
-                if (it->second.m_targetValue != targetValue)
+                if (!isOwnRange(it->second.m_targetValue))
                 {
                     rcTargetValue = std::max(rcTargetValue, it->second.m_targetValue);
                 }
@@ -249,7 +257,8 @@ void DependencyChecker::updateDb(uint64_t targetValue)
 uint64_t DependencyChecker::getTargetValueForWriteRange(uint64_t address,
                                                         uint64_t size,
                                                         uint64_t targetValue,
-                                                        bool     dbModificationIsAllowed)
+                                                        bool     dbModificationIsAllowed,
+                                                        uint64_t collectiveStartTargetValue)
 {
     VERIFY(m_lastTargetValue <= targetValue,
            "Unexpected targetValue={}, expected to be at least {}",
@@ -266,14 +275,16 @@ uint64_t DependencyChecker::getTargetValueForWriteRange(uint64_t address,
                                         address,
                                         size,
                                         targetValue,
-                                        dbModificationIsAllowed);
+                                        dbModificationIsAllowed,
+                                        collectiveStartTargetValue);
         rcTargetValue = std::max(rcTargetValue,
                                  checkDependency(DataOperationFlow::WRITE_AFTER_WRITE,
                                                  m_writeDb,
                                                  address,
                                                  size,
                                                  targetValue,
-                                                 dbModificationIsAllowed));
+                                                 dbModificationIsAllowed,
+                                                 collectiveStartTargetValue));
     }
 
     if (dbModificationIsAllowed) updateDb(rcTargetValue);
@@ -284,7 +295,8 @@ uint64_t DependencyChecker::getTargetValueForWriteRange(uint64_t address,
 uint64_t DependencyChecker::getTargetValueForReadRange(uint64_t address,
                                                        uint64_t size,
                                                        uint64_t targetValue,
-                                                       bool     dbModificationIsAllowed)
+                                                       bool     dbModificationIsAllowed,
+                                                       uint64_t collectiveStartTargetValue)
 {
     VERIFY(m_lastTargetValue <= targetValue,
            "Unexpected targetValue={}, expected to be at least {}",
@@ -300,14 +312,16 @@ uint64_t DependencyChecker::getTargetValueForReadRange(uint64_t address,
                                         address,
                                         size,
                                         targetValue,
-                                        dbModificationIsAllowed);
+                                        dbModificationIsAllowed,
+                                        collectiveStartTargetValue);
         rcTargetValue = std::max(rcTargetValue,
                                  checkDependency(DataOperationFlow::READ_AFTER_WRITE,
                                                  m_writeDb,
                                                  address,
                                                  size,
                                                  targetValue,
-                                                 dbModificationIsAllowed));
+                                                 dbModificationIsAllowed,
+                                                 collectiveStartTargetValue));
     }
 
     if (dbModificationIsAllowed) updateDb(rcTargetValue);
@@ -61,14 +61,18 @@ public:
     DependencyChecker&  operator=(DependencyChecker&)  = delete;
     DependencyChecker&& operator=(DependencyChecker&&) = delete;
 
+    // collectiveStartTargetValue - when not 0, ranges with a target value above it belong to the current (pipelined)
+    // collective and are not reported as a dependency. When 0, only ranges with the exact same target value are skipped.
     uint64_t getTargetValueForWriteRange(uint64_t address,
                                          uint64_t size,
                                          uint64_t targetValue,
-                                         bool     dbModificationIsAllowed = true);
+                                         bool     dbModificationIsAllowed    = true,
+                                         uint64_t collectiveStartTargetValue = 0);
     uint64_t getTargetValueForReadRange(uint64_t address,
                                         uint64_t size,
                                         uint64_t targetValue,
-                                        bool     dbModificationIsAllowed = true);
+                                        bool     dbModificationIsAllowed    = true,
+                                        uint64_t collectiveStartTargetValue = 0);
     void     updateDb(uint64_t targetValue);
 
 private:
@@ -82,6 +86,7 @@ private:
                              uint64_t                  address,
                              uint64_t                  size,
                              uint64_t                  targetValue,
-                             bool                      dbModificationIsAllowed = true);
+                             bool                      dbModificationIsAllowed    = true,
+                             uint64_t                  collectiveStartTargetValue = 0);
 
 };  // class DependencyChecker
\ No newline at end of file
@@ -236,9 +236,9 @@ void LibfabricScaleoutDescriptor::streamAddWait(spHostStreamFifo hostStream, fen
     HostSchedCommandsGen2Arch::serializeHostFenceCommand(hostStream, fence.index, srCount);
 }
 
-unsigned LibfabricScaleoutDescriptor::getHostUarchStreamIdx()
+unsigned LibfabricScaleoutDescriptor::getHostUarchStreamIdx(const HclCommConfig& config)
 {
-    return (GCFG_ENABLE_HNIC_MICRO_STREAMS.value() ? m_uarchStreamIdx : 0);
+    return (config.hnicMicroStreams ? m_uarchStreamIdx : 0);
 }
 
 void LibfabricScaleoutDescriptor::run(SliceState& sliceState)
@@ -249,7 +249,7 @@ void LibfabricScaleoutDescriptor::run(SliceState& sliceState)
     uint64_t hostAddress = provider.getHostBufferManager(m_archStreamIdx)
                                ->getCurrentBuffer(sliceState.m_isSend ? HNIC_SEND_POOL : HNIC_RECV_POOL);
     HCL_Rank remoteRank         = sliceState.m_dynamicComm.getScaleupGroupToRankMap()[sliceState.m_boxNumInfo.m_boxNum];
-    unsigned hostUarchStreamIdx = getHostUarchStreamIdx();
+    unsigned hostUarchStreamIdx = getHostUarchStreamIdx(sliceState.m_dynamicComm.getConfig());
 
     uint32_t remoteRankIteration = sliceState.m_all2allIter;
     uint32_t dataSize            = sliceState.m_execution.m_cellCount * sliceState.m_dataTypeSizeInBytes;
@@ -415,9 +415,9 @@ LibfabricNonCollectiveScaleoutDescriptor::LibfabricNonCollectiveScaleoutDescript
     VERIFY(m_scaleoutProvider.isHostNic(), "Cannot use libfabric descriptor on a non-hostnic provider");
 }
 
-unsigned LibfabricNonCollectiveScaleoutDescriptor::getHostUarchStreamIdx()
+unsigned LibfabricNonCollectiveScaleoutDescriptor::getHostUarchStreamIdx(const HclCommConfig& config)
 {
-    return (GCFG_ENABLE_HNIC_MICRO_STREAMS.value() ? m_uarchStreamIdx : 0);
+    return (config.hnicMicroStreams ? m_uarchStreamIdx : 0);
 }
 
 void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollectiveState)
@@ -435,7 +435,8 @@ void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollec
     const uint64_t             hostMappedAddress  = nonCollectiveState.m_hostMappedAddr;
     const uint64_t             hostAddress        = nonCollectiveState.m_hostAddr;
     const HCL_Rank             remoteRank         = nonCollectiveState.m_remoteRank;
-    unsigned                   hostUarchStreamIdx = getHostUarchStreamIdx();
+    unsigned                   hostUarchStreamIdx =
+        getHostUarchStreamIdx(nonCollectiveState.m_dynamicComm.getConfig());
 
     const uint32_t size =
         nonCollectiveState.m_execution.m_deviceCount * dataTypeSizeInBytes(nonCollectiveState.m_dataType);
@@ -519,6 +520,9 @@ void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollec
         HostStream* recvHostStream = provider.m_hostStreamVec[m_archStreamIdx][hostUarchStreamIdx][HOST_STREAM_RECV];
         HostStream* waitForCompHostStream =
             provider.m_hostStreamVec[m_archStreamIdx][hostUarchStreamIdx][HOST_STREAM_WAIT_FOR_RECV_COMP];
+
+        // The fence and the recv are published to the host scheduler together
+        recvHostStream->getOuterQueue()->beginBatch();
         if (nonCollectiveState.m_firstRank)
         {
             // Needs to be done once per arbitrator recv stream
@@ -552,6 +556,7 @@ void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollec
                                                                     compParams,
                                                                     recvHostStream->getSrCount(),
                                                                     nonCollectiveState.getQpSet());
+        recvHostStream->getOuterQueue()->endBatch();
         LOG_HCL_TRACE(HCL,
                       "scaleout recv's completion will signal to {}",
                       m_collectiveRoutines.getScalUtils()->printSOBInfo(sob1));
@@ -640,7 +645,7 @@ void GaudiDirectScaleoutDescriptor::run(SliceState& sliceState)
 
     uint32_t remoteRankIteration = sliceState.m_all2allIter;
     uint32_t dataSize            = sliceState.m_execution.m_cellCount * sliceState.m_dataTypeSizeInBytes;
-    unsigned hostUarchStreamIdx  = getHostUarchStreamIdx();
+    unsigned hostUarchStreamIdx  = getHostUarchStreamIdx(sliceState.m_dynamicComm.getConfig());
     uint32_t offsetForRecv       = 0;
     uint32_t offsetForSend       = 0;
 
@@ -778,7 +783,8 @@ void GaudiDirectNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonColl
     LibfabricScaleoutProvider& provider           = dynamic_cast<LibfabricScaleoutProvider&>(m_scaleoutProvider);
     const uint64_t             deviceAddr         = nonCollectiveState.m_execution.m_deviceAddress;
     const HCL_Rank             remoteRank         = nonCollectiveState.m_remoteRank;
-    unsigned                   hostUarchStreamIdx = getHostUarchStreamIdx();
+    unsigned                   hostUarchStreamIdx =
+        getHostUarchStreamIdx(nonCollectiveState.m_dynamicComm.getConfig());
     const uint32_t             soAddr             = nonCollectiveState.m_execution.m_completionSoAddr;
     const sob_info             sob(m_collectiveRoutines.getScalUtils()->getSOBInfo(soAddr));
 
@@ -842,6 +848,9 @@ void GaudiDirectNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonColl
         HostStream* recvHostStream = provider.m_hostStreamVec[m_archStreamIdx][hostUarchStreamIdx][HOST_STREAM_RECV];
         HostStream* waitForCompHostStream =
             provider.m_hostStreamVec[m_archStreamIdx][hostUarchStreamIdx][HOST_STREAM_WAIT_FOR_RECV_COMP];
+
+        // The fence and the recv are published to the host scheduler together
+        recvHostStream->getOuterQueue()->beginBatch();
         if (nonCollectiveState.m_firstRank)
         {
             // Needs to be done once per arbitrator recv stream
@@ -877,6 +886,7 @@ void GaudiDirectNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonColl
                                                                     compParams,
                                                                     recvHostStream->getSrCount(),
                                                                     nonCollectiveState.getQpSet());
+        recvHostStream->getOuterQueue()->endBatch();
 
         HostSchedCommandsGen2Arch::serializeHostWaitForCompletionCommand(waitForCompHostStream->getOuterQueue(),
                                                                          nonCollectiveState.m_comm,
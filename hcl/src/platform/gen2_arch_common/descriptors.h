@@ -13,6 +13,7 @@
 class ScaleoutProvider;
 class NonCollectiveState;
 struct SliceState;
+struct HclCommConfig;
 class HclCollectiveRoutinesGen2Arch;
 namespace hcl
 {
@@ -116,7 +117,7 @@ public:
 
 protected:
     void     streamAddWait(spHostStreamFifo hostStream, fence_info fence, const uint64_t srCount);
-    unsigned getHostUarchStreamIdx();
+    unsigned getHostUarchStreamIdx(const HclCommConfig& config);
 
     HclCommandsGen2Arch& m_commands;
 
@@ -140,7 +141,7 @@ public:
     virtual void run(NonCollectiveState& nonCollectiveState) override;
 
 protected:
-    unsigned getHostUarchStreamIdx();
+    unsigned getHostUarchStreamIdx(const HclCommConfig& config);
 
     HclCommandsGen2Arch& m_commands;
 
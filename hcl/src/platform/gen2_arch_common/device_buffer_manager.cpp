@@ -29,6 +29,8 @@ DeviceBufferManager::DeviceBufferManager(std::array<BufferParams, MAX_NUM_POOL_S
             poolIndex++;
         }
     }
+    m_allocationCount = std::vector<std::atomic<uint64_t>>(m_creditManagers.size());
+    m_stallCount      = std::vector<std::atomic<uint64_t>>(m_creditManagers.size());
     VERIFY(GCFG_HCL_SCALEOUT_BUFFER_FACTOR.value() <= MAX_SCALEOUT_FACTOR,
            "HCL_SCALEOUT_BUFFER_FACTOR({}) is expected to be <= {}",
            GCFG_HCL_SCALEOUT_BUFFER_FACTOR.value(),
@@ -132,6 +134,25 @@ uint64_t DeviceBufferManager::allocNextBuffer(uint64_t targetValue, const e_devi
     return m_creditManagers[poolIdx].allocNextCredit(targetValue);
 }
 
+void DeviceBufferManager::recordAllocation(const e_devicePoolID poolIdx, bool stalled)
+{
+    m_allocationCount[poolIdx].fetch_add(1, std::memory_order_relaxed);
+    if (stalled)
+    {
+        m_stallCount[poolIdx].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t DeviceBufferManager::getAllocationCount(const e_devicePoolID poolIdx) const
+{
+    return m_allocationCount.at(poolIdx).load(std::memory_order_relaxed);
+}
+
+uint64_t DeviceBufferManager::getStallCount(const e_devicePoolID poolIdx) const
+{
+    return m_stallCount.at(poolIdx).load(std::memory_order_relaxed);
+}
+
 unsigned DeviceBufferManager::getPoolSizeIndex(const e_devicePoolID poolIdx)
 {
     if (poolIdx == SCALEOUT_POOL)
@@ -1,5 +1,6 @@
 
 #pragma once
+#include <atomic>   // for atomic
 #include <cstdint>  // for int64_t, uint64_t, uint32_t
 #include <vector>   // for vector
 
@@ -56,7 +57,16 @@ public:
     uint64_t              getBufferAmountInPool(unsigned poolId);
     static const unsigned getFactor(const e_devicePoolID poolIdx);
 
+    // Usage statistics used to tune pool counts (HCL_IMB_*_POOL_COUNT / HCL_IMB_HBM_BUDGET), also read by the
+    // metrics exporter thread
+    void     recordAllocation(const e_devicePoolID poolIdx, bool stalled);
+    uint64_t getAllocationCount(const e_devicePoolID poolIdx) const;
+    uint64_t getStallCount(const e_devicePoolID poolIdx) const;
+
 private:
+    std::vector<std::atomic<uint64_t>> m_allocationCount;
+    std::vector<std::atomic<uint64_t>> m_stallCount;
+
     // Granularity requirements for buffers:
     // 8 for scaleup buffers pool
     // All values must be a power of 2
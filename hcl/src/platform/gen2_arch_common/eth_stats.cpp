@@ -9,6 +9,7 @@
 #include <netinet/in.h>
 #include <unistd.h>
 #include <sstream>
+#include <algorithm>  // for transform
 
 #include "hcl_log_manager.h"
 
@@ -322,3 +323,36 @@ std::vector<std::vector<uint64_t>> EthStats::getEthStatsVal()
 
     return rtn;
 }
+
+static bool isErrorStat(std::string statName)
+{
+    static const std::vector<std::string> errorStatTokens = {"err", "fault", "drop", "crc"};
+
+    std::transform(statName.begin(), statName.end(), statName.begin(), ::tolower);
+    return std::any_of(errorStatTokens.begin(), errorStatTokens.end(), [&](const std::string& token) {
+        return statName.find(token) != std::string::npos;
+    });
+}
+
+std::map<int, uint64_t> EthStats::getErrorCounts()
+{
+    std::map<int, uint64_t> rtn;
+
+    for (const auto& interface : m_habanaInterfaces)
+    {
+        if (interface.port < 0 || interface.statsNames.size() != interface.numStats) continue;
+
+        const std::vector<uint64_t> statsVal = getStats(interface);
+
+        uint64_t errorCount = 0;
+        for (unsigned i = 0; i < interface.numStats; i++)
+        {
+            // failed reads are filled with max
+            if (statsVal[i] == std::numeric_limits<uint64_t>::max() || !isErrorStat(interface.statsNames[i])) continue;
+            errorCount += statsVal[i];
+        }
+        rtn[interface.port] = errorCount;
+    }
+
+    return rtn;
+}
@@ -23,6 +23,7 @@ public:
     void                               dump(hl_logger::LoggerSPtr usrLogger, bool dumpAll);
     const std::vector<InterfaceInfo>&  getInterfaces() const { return m_habanaInterfaces; };
     std::vector<std::vector<uint64_t>> getEthStatsVal();
+    std::map<int, uint64_t>            getErrorCounts();  // port -> sum of its error counters
 
 private:
     void getHabanaInterfaces(std::string pciAddr);
@@ -123,6 +123,11 @@ hcclResult_t hccl_device_t::init(uint8_t apiId)
 {
     hcclResult_t rc = init_device(apiId);  // call device specific init (overriden)
     aggregators_.init();
+    if (rc == hcclSuccess)
+    {
+        device_->startMetricsExporter();
+        device_->startScaleOutPortHealth();
+    }
 
     return rc;
 }
@@ -145,6 +150,16 @@ hcclResult_t hccl_device_t::group(bool start)
     return rc;
 }
 
+bool hccl_device_t::in_group() const
+{
+    for (const auto& agg : aggregators_)
+    {
+        if (agg->inGroup()) return true;
+    }
+
+    return false;
+}
+
 hccl_device_t::~hccl_device_t() noexcept(false)
 {
     if (!initialized) return;
@@ -235,13 +250,20 @@ static hcclResult_t selfRankMemcpy(const HclCollectiveParams& params)
 
 hcclResult_t hccl_device_t::collective_call(HclCollectiveParams& params)
 {
+    if (params.m_dynamicComm.m_metrics)
+    {
+        params.m_dynamicComm.m_metrics->onCollective(params.m_collectiveOp,
+                                                     params.m_count,
+                                                     dataTypeSizeInBytes(params.m_dataType));
+    }
+
     if (params.m_collectiveOp == eHCLReduce || params.m_collectiveOp == eHCLAllReduce ||
         params.m_collectiveOp == eHCLBroadcast || params.m_collectiveOp == eHCLReduceScatter ||
         params.m_collectiveOp == eHCLAllGather || params.m_collectiveOp == eHCLAll2All)
     {
         // single rank communicator, not loopback
         if (params.m_dynamicComm.getCommSize() == 1 &&
-            (HclConfigType)GCFG_BOX_TYPE_ID.value() != HclConfigType::LOOPBACK)
+            params.m_dynamicComm.getConfig().boxType != HclConfigType::LOOPBACK)
         {
             return selfRankMemcpy(params);
         }
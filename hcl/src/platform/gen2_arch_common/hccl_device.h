@@ -56,6 +56,7 @@ public:
     virtual hcclResult_t init(uint8_t apiId);
     virtual void         initComm(const HCL_Comm commId);
     virtual hcclResult_t group(bool start);
+    virtual bool         in_group() const;  // calling thread is between a group start and its end
     virtual hcclResult_t send_recv_call(int myRank, const SendRecvApiEntry& entry);
     virtual hcclResult_t collective_call(HclCollectiveParams& params);
 
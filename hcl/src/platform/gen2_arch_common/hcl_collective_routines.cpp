@@ -4,8 +4,8 @@
 #include <algorithm>           // for max
 #include <cstdint>             // for uint64_t
 #include <string>              // for string
-#include <unordered_map>       // for unordered_map
 #include <set>                 // for set
+#include <optional>            // for optional
 
 #include "hcl_collective_params.h"                            // for HclColl...
 #include "hcl_global_conf.h"                                  // for GCFG_WE...
@@ -32,6 +32,7 @@
 #include "platform/gen2_arch_common/active_stream_manager.h"
 #include "platform/gen2_arch_common/hcl_device_controller.h"
 #include "platform/gen2_arch_common/server_def.h"  // for Gen2ArchServerDef
+#include "infra/hcl_latency_stats.h"               // for CollectiveLatencyStats, ScopedPhaseTimer
 
 #include "hcl_device_control_factory.h"
 #include "hcl_math_utils.h"
@@ -224,6 +225,9 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
                                                      const std::set<HCL_Rank>&          remoteRanks,
                                                      uint8_t                            apiId)
 {
+    CollectiveLatencyStats& latencyStats = m_device->getComm(comm).m_latencyStats;
+    const uint64_t          startNsec    = latencyStats.isStarted() ? CollectiveLatencyStats::nowNsec() : 0;
+
     ScopedNullSubmit scopedNullSubmit(m_streamId, m_deviceController);
 
     const bool isHnicsRequired = m_scaleoutProvider->isHostNic();
@@ -234,6 +238,9 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
                   isHnicsRequired);
     std::lock_guard<std::mutex> lock(m_deviceController.getStreamLock(m_streamId));
 
+    HclDynamicCommunicator& dynamicComm = m_device->getComm(comm);
+    const HclCommConfig&    config      = dynamicComm.getConfig();
+
     std::set<HCL_Rank> remoteOuterRanks;
     for (const HCL_Rank remoteRank : remoteRanks)
     {
@@ -339,29 +346,26 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
                                             (unsigned)sendRecvMemCpyVec.size());
     LOG_HCL_TRACE(HCL, "numIterations={}", numIterations);
 
-    std::unordered_map<HCL_Rank, unsigned> qpSetIterPerSendPeerRank;
+    const size_t   numScaleupGroups = div_round_up(dynamicComm.getCommSize(), dynamicComm.getScaleupGroupSize());
+    PeerQpSetIters qpSetIterPerSendPeer(numScaleupGroups, NO_PEER_QP_SET_ITER);
     for (const SendRecvEntry& entry : orderedSendList)
     {
-        if (m_device->getComm(comm).isPeer(entry.remoteRank))
+        if (dynamicComm.isPeer(entry.remoteRank))
         {
-            qpSetIterPerSendPeerRank[entry.remoteRank] = 0;
-            LOG_HCL_TRACE(HCL, "Added qpSetIterPerSendPeerRank for rank ", entry.remoteRank);
+            qpSetIterPerSendPeer[dynamicComm.getRankToScaleupGroupMap()[entry.remoteRank]] = 0;
+            LOG_HCL_TRACE(HCL, "Added qpSetIterPerSendPeer for rank {}", entry.remoteRank);
         }
     }
 
-    std::unordered_map<HCL_Rank, unsigned> qpSetIterPerRecvPeerRank;
+    PeerQpSetIters qpSetIterPerRecvPeer(numScaleupGroups, NO_PEER_QP_SET_ITER);
     for (const SendRecvEntry& entry : orderedRecvList)
     {
-        if (m_device->getComm(comm).isPeer(entry.remoteRank))
+        if (dynamicComm.isPeer(entry.remoteRank))
         {
-            qpSetIterPerRecvPeerRank[entry.remoteRank] = 0;
-            LOG_HCL_TRACE(HCL, "Added qpSetIterPerRecvPeerRank for rank ", entry.remoteRank);
+            qpSetIterPerRecvPeer[dynamicComm.getRankToScaleupGroupMap()[entry.remoteRank]] = 0;
+            LOG_HCL_TRACE(HCL, "Added qpSetIterPerRecvPeer for rank {}", entry.remoteRank);
         }
     }
-    LOG_HCL_TRACE(HCL,
-                  "qpSetIterPerSendPeerRank.size={}, qpSetIterPerRecvPeerRank.size()={}",
-                  qpSetIterPerSendPeerRank.size(),
-                  qpSetIterPerRecvPeerRank.size());
 
     uint64_t startTgtVal = m_longSo.targetValue;
 
@@ -396,7 +400,7 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
                 scaleupSendIter[hwModId] = scaleupSendGroups.at(hwModId)[iter];
                 sendCnt++;
 
-                if (!GCFG_WEAK_ORDER.value() && GCFG_ENABLE_DEPENDENCY_CHECKER.value())
+                if (config.checkDependencies)
                 {
                     dependencyRunningTargetVal = checkSendRecvDependency(
                         scaleupSendIter[hwModId].address,
@@ -411,7 +415,7 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
             {
                 scaleupRecvIter[hwModId] = scaleupRecvGroups.at(hwModId)[iter];
 
-                if (!GCFG_WEAK_ORDER.value() && GCFG_ENABLE_DEPENDENCY_CHECKER.value())
+                if (config.checkDependencies)
                 {
                     dependencyRunningTargetVal = checkSendRecvDependency(
                         scaleupRecvIter[hwModId].address,
@@ -438,7 +442,7 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
             countScaleOutSignalsSendRecv(scaleoutSendIter.size(), scaleoutRecvIter.size(), comm);
         LOG_HCL_TRACE(HCL, "iter={}, iterScaleoutSignals={}", iter, iterScaleoutSignals);
 
-        if (!GCFG_WEAK_ORDER.value() && GCFG_ENABLE_DEPENDENCY_CHECKER.value())
+        if (config.checkDependencies)
         {
             for (auto& scaleOutSend : scaleoutSendIter)
             {
@@ -469,7 +473,7 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
         {
             iterMemcpyVec.push_back(sendRecvMemCpyVec.at(iter));
 
-            if (!GCFG_WEAK_ORDER.value() && GCFG_ENABLE_DEPENDENCY_CHECKER.value())
+            if (config.checkDependencies)
             {
                 // Src Address
                 dependencyRunningTargetVal = checkSendRecvDependency(iterMemcpyVec[0].sendBaseAddress,
@@ -553,12 +557,12 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
         createScaleOutSendProgsNonCollective(scaleoutSendIter,
                                              comm,
                                              requiredCredits,
-                                             qpSetIterPerSendPeerRank,
+                                             qpSetIterPerSendPeer,
                                              commonState);
         createScaleOutRecvProgsNonCollective(scaleoutRecvIter,
                                              comm,
                                              requiredCredits,
-                                             qpSetIterPerRecvPeerRank,
+                                             qpSetIterPerRecvPeer,
                                              commonState);
 
         createDmaProgsNonCollective(0, requiredCredits);
@@ -568,6 +572,11 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
 
     m_device->getComm(comm).m_streamLatestLongSo[m_streamId] = m_longSo.targetValue;
 
+    if (latencyStats.isStarted())
+    {
+        latencyStats.onSubmit(eHCLNoCollective, startNsec, m_streamId, m_longSo.targetValue);
+    }
+
     LOG_TRACE(HCL_CG,
               SCAL_PROGRESS_HCL_FMT "sendRecv: num iterations {}, longSo before {:x}",
               m_streamId,
@@ -581,6 +590,9 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
 
 hcclResult_t HclCollectiveRoutinesGen2Arch::hclCollectiveCall(HclCollectiveParams& params)
 {
+    CollectiveLatencyStats& latencyStats = params.m_dynamicComm.m_latencyStats;
+    const uint64_t          startNsec    = latencyStats.isStarted() ? CollectiveLatencyStats::nowNsec() : 0;
+
     ScopedNullSubmit scopedNullSubmit(m_streamId, m_deviceController);
 
     std::lock_guard<std::mutex> lock(m_deviceController.getStreamLock(m_streamId));
@@ -594,6 +606,7 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::hclCollectiveCall(HclCollectiveParam
                              m_serverConnectivity.getNumScaleOutPorts(params.m_dynamicComm),
                              m_device->getSignalsCalculator(),
                              this->m_remainderCalculator};
+    commonState.m_measureLatency = latencyStats.isStarted();
 
     // handle a portion of data that fits the relevant slice in each iteration
     // slice: [0, 1, ..., numSlices - 1]
@@ -654,6 +667,7 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::hclCollectiveCall(HclCollectiveParam
         // handle a portion of data relevant for a specific box in each iteration
         // send: [myBox, myBox + 1, ..., myBox + (numBoxes - 1)]
         // recv: [myBox, myBox - 1, ..., myBox - (numBoxes - 1)]
+        // (All2All may use a different peer order, see CommonState::calcAll2AllSchedule)
         for (unsigned boxIter = 0; boxIter < commonState.m_boxIterations; ++boxIter)
         {
             switch (commonState.m_collectiveOp)
@@ -690,6 +704,15 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::hclCollectiveCall(HclCollectiveParam
               params.m_collectiveOp,
               startTgtVal);
 
+    if (latencyStats.isStarted())
+    {
+        latencyStats.onSubmit(params.m_collectiveOp,
+                              startNsec,
+                              m_streamId,
+                              m_longSo.targetValue,
+                              commonState.getPhaseLatencies());
+    }
+
     return hcclSuccess;
 }
 
@@ -712,11 +735,8 @@ void HclCollectiveRoutinesGen2Arch::hclCollectiveCall(CommonState&     commonSta
           commonState.m_collectiveOp == eHCLSimpleBroadcast) &&
          commonState.m_dynamicComm.getScaleupGroupSize() != 1);
 
-    const unsigned nextBox = mod(commonState.m_dynamicComm.getMyScaleupGroup() + boxIter, commonState.m_boxIterations);
-
-    const unsigned prevBox =
-        mod(commonState.m_boxIterations + (int)commonState.m_dynamicComm.getMyScaleupGroup() - (int)boxIter,
-            commonState.m_boxIterations);
+    const unsigned nextBox = commonState.getNextBoxForIter(boxIter);
+    const unsigned prevBox = commonState.getPrevBoxForIter(boxIter);
     BoxNumInfo boxNumInfo =
         BoxNumInfo(scaleOutFirstOp ? prevBox : nextBox,
                    scaleOutFirstOp ? BoxNumInfo::boxOrientation::PREV_BOX : BoxNumInfo::boxOrientation::NEXT_BOX);
@@ -724,16 +744,20 @@ void HclCollectiveRoutinesGen2Arch::hclCollectiveCall(CommonState&     commonSta
     BoxNumInfo prevBoxNumInfo(prevBox, BoxNumInfo::boxOrientation::PREV_BOX);
 
     const bool isFirstBox = (boxNumInfo.m_boxNum == commonState.m_dynamicComm.getMyScaleupGroup());
-    const bool isLastBox =
-        (mod(boxNumInfo.m_boxNum + 1, commonState.m_boxIterations) == commonState.m_dynamicComm.getMyScaleupGroup());
+    const bool isLastBox  = commonState.isLastBoxIter(boxNumInfo, true);
 
     uint64_t cuid = commonState.calculateCUID(isFirstBox, isLastBox);
 
     uint64_t dependencyTargetVal = 0;
 
+    // Check dependency per slice, when collective pipelining is enabled
+    const bool checkDependencies = commonState.m_dynamicComm.getConfig().checkDependencies;
+    if (checkDependencies && isSlicePipeliningEnabled(commonState) && isFirstOp && boxIter == firstBoxIter)
+    {
+        dependencyTargetVal = checkCollectiveSliceDependency(commonState, sliceIter);
+    }
     // Check dependency per collective
-    if (!GCFG_WEAK_ORDER.value() && GCFG_ENABLE_DEPENDENCY_CHECKER.value() && sliceIter == 0 && isFirstOp &&
-        boxIter == firstBoxIter)
+    else if (checkDependencies && sliceIter == 0 && isFirstOp && boxIter == firstBoxIter)
     {
         uint64_t totalBoxIterations = 0;
         if (commonState.m_collectiveOp == eHCLBroadcast)
@@ -827,6 +851,7 @@ void HclCollectiveRoutinesGen2Arch::hclCollectiveCall(CommonState&     commonSta
 
     if (boxIter != 0)  // don't call scaleout functionality for boxIter=0
     {
+        ScopedPhaseTimer scaleOutTimer(commonState.getPhaseLatencies(), LatencyPhase::SCALE_OUT);
         negotiateScaleoutResources(sendSliceState, isFirstBox, isLastBox);
         negotiateScaleoutResources(recvSliceState, isFirstBox, isLastBox);
     }
@@ -838,6 +863,8 @@ void HclCollectiveRoutinesGen2Arch::hclCollectiveCall(CommonState&     commonSta
     unsigned completionSignals = m_signalsManager->getNumSignalsForCompletion();
 
     // The next calls are to fill the five sched with programs
+    std::optional<ScopedPhaseTimer> phaseTimer;
+    phaseTimer.emplace(commonState.getPhaseLatencies(), LatencyPhase::SCALE_UP);
     createScaleUpSendProgs(sendSliceState.isComplexImplementation() && sendSliceState.m_currentOp != eHCLReduceScatter
                                ? recvSliceState
                                : sendSliceState,
@@ -854,19 +881,22 @@ void HclCollectiveRoutinesGen2Arch::hclCollectiveCall(CommonState&     commonSta
                            requiredCredits,
                            commonState.m_currentOp);
 
+    phaseTimer.emplace(commonState.getPhaseLatencies(), LatencyPhase::SCALE_OUT);
     createScaleOutSendProgs(sendSliceState, requiredCredits);
     createScaleOutRecvProgs(recvSliceState, requiredCredits);
 
+    phaseTimer.emplace(commonState.getPhaseLatencies(), LatencyPhase::REDUCTION);
     createDmaProgs(sendSliceState,
                    recvSliceState,
                    recvSliceState.getChunkCountToClear() * dataTypeSizeInBytes(commonState.m_dataType),
                    requiredCredits,
                    commonState.m_dataType);
+    phaseTimer.reset();
 
     bool submitToHw = true;
 
-    if (GCFG_HCL_SUBMIT_THRESHOLD.isSetFromUserConfig() && m_scaleoutProvider->isGaudiDirect() &&
-        sendSliceState.m_isMultiScaleupGroup)
+    const HclCommConfig& config = commonState.m_dynamicComm.getConfig();
+    if (config.submitThresholdSet && m_scaleoutProvider->isGaudiDirect() && sendSliceState.m_isMultiScaleupGroup)
     {
         commonState.m_submitCounter++;
         bool lastIterInCollective = ((sendSliceState.m_sliceIter + 1) == sendSliceState.m_sliceIterations &&
@@ -874,7 +904,7 @@ void HclCollectiveRoutinesGen2Arch::hclCollectiveCall(CommonState&     commonSta
         bool all2allLastIter      = (sendSliceState.m_collectiveOp != eHCLAll2All ||
                                 (sendSliceState.m_all2allIter + 1) == sendSliceState.m_all2allIterations);
         submitToHw                = ((lastIterInCollective && all2allLastIter) ||
-                      commonState.m_submitCounter == GCFG_HCL_SUBMIT_THRESHOLD.value());
+                      commonState.m_submitCounter == config.submitThreshold);
         if (submitToHw)
         {
             s_submitCounter = 0;
@@ -920,6 +950,81 @@ uint64_t HclCollectiveRoutinesGen2Arch::checkSendRecvDependency(uint64_t address
     }
 }
 
+bool HclCollectiveRoutinesGen2Arch::isSlicePipeliningEnabled(CommonState& commonState) const
+{
+    // Only AllReduce is tracked per slice - each of its slices covers one contiguous range per box in both the send
+    // and the recv buffers, and is completed by the slice's own RS and AG iterations.
+    return commonState.m_dynamicComm.getConfig().collectivePipelining && commonState.m_collectiveOp == eHCLAllReduce &&
+           commonState.m_sliceIterations > 1;
+}
+
+uint64_t HclCollectiveRoutinesGen2Arch::checkCollectiveSliceDependency(CommonState& commonState, unsigned sliceIter)
+{
+    // Each AllReduce slice runs RS over all boxes followed by AG over all boxes
+    const uint64_t sliceBoxIterations = 2 * commonState.m_boxIterations;
+
+    // Called before this slice's first iteration advanced the long SO
+    const uint64_t collectiveStartTargetValue = m_longSo.targetValue - (sliceIter * sliceBoxIterations);
+    const uint64_t sliceTargetValue           = m_longSo.targetValue + sliceBoxIterations;
+
+    const uint64_t typeSize     = commonState.m_dataTypeSizeInBytes;
+    const uint64_t sliceOffset  = commonState.m_sliceOffsetCount * typeSize;
+    const uint64_t boxStride    = commonState.m_boxStrideCount * typeSize;
+    const uint64_t totalSize    = commonState.m_count * typeSize;
+    const bool     isLastSlice  = (sliceIter + 1) == commonState.m_sliceIterations;
+    const bool     checkSendBuf = commonState.isSendAddrValid() && !commonState.m_inPlace;
+
+    uint64_t dependencyTargetVal = 0;
+
+    auto checkRange = [&](uint64_t offset, uint64_t size) {
+        if (commonState.isRecvAddrValid())
+        {
+            dependencyTargetVal =
+                std::max(dependencyTargetVal,
+                         m_dependencyChecker->getTargetValueForWriteRange(commonState.m_recvBufferAddr + offset,
+                                                                          size,
+                                                                          sliceTargetValue,
+                                                                          true,
+                                                                          collectiveStartTargetValue));
+        }
+        if (checkSendBuf)
+        {
+            dependencyTargetVal =
+                std::max(dependencyTargetVal,
+                         m_dependencyChecker->getTargetValueForReadRange(commonState.m_sendBufferAddr + offset,
+                                                                         size,
+                                                                         sliceTargetValue,
+                                                                         true,
+                                                                         collectiveStartTargetValue));
+        }
+    };
+
+    if (isLastSlice)
+    {
+        // The last slice carries the remainder, whose exact per-box placement depends on the remainder calculator, so
+        // conservatively cover everything from the slice start in the first box up to the end of the buffer.
+        checkRange(sliceIter * sliceOffset, totalSize - std::min(totalSize, sliceIter * sliceOffset));
+    }
+    else
+    {
+        for (unsigned box = 0; box < commonState.m_boxIterations; box++)
+        {
+            const uint64_t offset = box * boxStride + sliceIter * sliceOffset;
+            if (offset >= totalSize) break;
+            checkRange(offset, std::min(sliceOffset, totalSize - offset));
+        }
+    }
+
+    LOG_HCL_TRACE(HCL,
+                  "Slice dependency: sliceIter={}, collectiveStart={}, sliceTarget={}, dependencyTargetVal={}",
+                  sliceIter,
+                  collectiveStartTargetValue,
+                  sliceTargetValue,
+                  dependencyTargetVal);
+
+    return dependencyTargetVal;
+}
+
 uint64_t HclCollectiveRoutinesGen2Arch::checkCollectiveDependency(CommonState& commonState,
                                                                   uint64_t     targetValue,
                                                                   bool         dbModificationIsAllowed)
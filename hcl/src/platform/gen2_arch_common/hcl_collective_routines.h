@@ -52,6 +52,12 @@ class ScaleoutProvider;
 class DeviceBufferManager;
 class HclGraphSyncGen2Arch;
 
+// Next QP set iteration of each scaleout peer of a send/recv group. A rank has a single peer in each scaleup group, so
+// the array is indexed by the peer's scaleup group, NO_PEER_QP_SET_ITER marks scaleup groups with no peer in the group.
+using PeerQpSetIters = llvm_vecsmall::SmallVector<unsigned, 64>;
+
+static constexpr unsigned NO_PEER_QP_SET_ITER = (unsigned)-1;
+
 class HclCollectiveRoutinesGen2Arch : public IHclCollectiveRoutines
 {
 public:
@@ -92,6 +98,8 @@ public:
                                      bool     dbModificationIsAllowed = true);
     uint64_t
     checkCollectiveDependency(CommonState& commonState, uint64_t targetValue, bool dbModificationIsAllowed = true);
+    bool     isSlicePipeliningEnabled(CommonState& commonState) const;
+    uint64_t checkCollectiveSliceDependency(CommonState& commonState, unsigned sliceIter);
 
     uint32_t getSoConfigValue(unsigned value, bool isReduction);
 
@@ -156,17 +164,17 @@ protected:
                                              HCL_Comm             comm,
                                              unsigned             requiredCredits);
 
-    void createScaleOutSendProgsNonCollective(const SendRecvVector&                   sendVec,
-                                              const HCL_Comm                          comm,
-                                              const unsigned                          requiredCredits,
-                                              std::unordered_map<HCL_Rank, unsigned>& qpSetIterPerSendPeerRank,
-                                              const CommonState&                      commonState);
-
-    void createScaleOutRecvProgsNonCollective(const SendRecvVector&                   recvVec,
-                                              const HCL_Comm                          comm,
-                                              const unsigned                          requiredCredits,
-                                              std::unordered_map<HCL_Rank, unsigned>& qpSetIterPerRecvPeerRank,
-                                              const CommonState&                      commonState);
+    void createScaleOutSendProgsNonCollective(const SendRecvVector& sendVec,
+                                              const HCL_Comm        comm,
+                                              const unsigned        requiredCredits,
+                                              PeerQpSetIters&       qpSetIterPerSendPeer,
+                                              const CommonState&    commonState);
+
+    void createScaleOutRecvProgsNonCollective(const SendRecvVector& recvVec,
+                                              const HCL_Comm        comm,
+                                              const unsigned        requiredCredits,
+                                              PeerQpSetIters&       qpSetIterPerRecvPeer,
+                                              const CommonState&    commonState);
 
     void createScaleOutSendProgs(SliceState& sliceState, unsigned requiredCredits);
 
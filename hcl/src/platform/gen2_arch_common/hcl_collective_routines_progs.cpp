@@ -1310,11 +1310,11 @@ void HclCollectiveRoutinesGen2Arch::createScaleOutRecvProgs(SliceState& sliceSta
 }
 
 void HclCollectiveRoutinesGen2Arch::createScaleOutSendProgsNonCollective(
-    const SendRecvVector&                   sendVec,
-    const HCL_Comm                          comm,
-    const unsigned                          requiredCredits,
-    std::unordered_map<HCL_Rank, unsigned>& qpSetIterPerSendPeerRank,
-    const CommonState&                      commonState)
+    const SendRecvVector& sendVec,
+    const HCL_Comm        comm,
+    const unsigned        requiredCredits,
+    PeerQpSetIters&       qpSetIterPerSendPeer,
+    const CommonState&    commonState)
 {
     LOG_HCL_TRACE(HCL, "requiredCredits={}, sendVec.size={}", requiredCredits, sendVec.size());
     hcl::ScalStream& arbitratorStream = m_activeStreamManager.getArbitratorStream(hcl::SchedulersIndex::sendScaleOut);
@@ -1412,9 +1412,9 @@ void HclCollectiveRoutinesGen2Arch::createScaleOutSendProgsNonCollective(
                                    hostAddr);
         if (m_device->getComm(comm).isPeer(remoteRank))
         {
-            VERIFY(qpSetIterPerSendPeerRank.count(remoteRank) != 0);
-            const unsigned qpSetIter = qpSetIterPerSendPeerRank[remoteRank]++;
-            sendSliceState.calcSliceQpSet(qpSetIter);
+            unsigned& qpSetIter = qpSetIterPerSendPeer[remoteBox];
+            VERIFY(qpSetIter != NO_PEER_QP_SET_ITER, "No QP set iteration for peer rank {}", remoteRank);
+            sendSliceState.calcSliceQpSet(qpSetIter++);
         }
         else
         {
@@ -1489,11 +1489,11 @@ void HclCollectiveRoutinesGen2Arch::createScaleOutSendProgsNonCollective(
 }
 
 void HclCollectiveRoutinesGen2Arch::createScaleOutRecvProgsNonCollective(
-    const SendRecvVector&                   recvVec,
-    const HCL_Comm                          comm,
-    const unsigned                          requiredCredits,
-    std::unordered_map<HCL_Rank, unsigned>& qpSetIterPerRecvPeerRank,
-    const CommonState&                      commonState)
+    const SendRecvVector& recvVec,
+    const HCL_Comm        comm,
+    const unsigned        requiredCredits,
+    PeerQpSetIters&       qpSetIterPerRecvPeer,
+    const CommonState&    commonState)
 {
     LOG_HCL_TRACE(HCL, "comm={}, requiredCredits={}, recvVec.size={}", comm, requiredCredits, recvVec.size());
 
@@ -1604,9 +1604,9 @@ void HclCollectiveRoutinesGen2Arch::createScaleOutRecvProgsNonCollective(
                                    hostAddr);
         if (m_device->getComm(comm).isPeer(remoteRank))
         {
-            VERIFY(qpSetIterPerRecvPeerRank.count(remoteRank) != 0);
-            const unsigned qpSetIter = qpSetIterPerRecvPeerRank[remoteRank]++;
-            recvSliceState.calcSliceQpSet(qpSetIter);
+            unsigned& qpSetIter = qpSetIterPerRecvPeer[remoteBox];
+            VERIFY(qpSetIter != NO_PEER_QP_SET_ITER, "No QP set iteration for peer rank {}", remoteRank);
+            recvSliceState.calcSliceQpSet(qpSetIter++);
         }
         else
         {
@@ -390,7 +390,7 @@ void HclCollectiveRoutinesGen2Arch::getDeviceToRemoteIndex(CommonState&   common
                 VERIFY(false, "getDeviceToRemoteIndex: unsupported current op {}", commonState.m_currentOp);
         }
 
-        if (incWqeTracker && !GCFG_HCL_NULL_SUBMIT.value())
+        if (incWqeTracker && !commonState.m_dynamicComm.getConfig().nullSubmit)
         {
             m_wqeTracker->incWqe(commonState.m_dynamicComm,
                                  mod(rank, commonState.m_dynamicComm.getScaleupGroupSize()),
@@ -574,8 +574,9 @@ unsigned int HclCollectiveRoutinesGen2Arch::calcRequiredCreditAmount(CommonState
         }
     }
 
-    bool           firstOpInGroup      = false;
-    const uint64_t groupMaxTargetValue = getGroupMaxTargetValue();
+    const HclCommConfig& config              = commonState.m_dynamicComm.getConfig();
+    bool                 firstOpInGroup      = false;
+    const uint64_t       groupMaxTargetValue = getGroupMaxTargetValue();
     if (getGroupContext())
     {
         if (m_groupContextStrongOrder)
@@ -586,7 +587,7 @@ unsigned int HclCollectiveRoutinesGen2Arch::calcRequiredCreditAmount(CommonState
         {
             m_groupContextStrongOrder = true;
             firstOpInGroup            = true;
-            if (GCFG_ENABLE_DEPENDENCY_CHECKER.value())
+            if (config.dependencyChecker)
             {
                 LOG_HCL_TRACE(HCL, "Waiting on target value {}", groupMaxTargetValue);
                 m_dependencyChecker->updateDb(groupMaxTargetValue);
@@ -595,15 +596,15 @@ unsigned int HclCollectiveRoutinesGen2Arch::calcRequiredCreditAmount(CommonState
         }
     }
 
-    if (!GCFG_WEAK_ORDER.isSetFromDefault())
+    if (config.weakOrderOverride)
     {
-        flags.weak_order = GCFG_WEAK_ORDER.value();
+        flags.weak_order = config.weakOrder;
         LOG_HCL_DEBUG(HCL, "weak order flag = {}", flags.weak_order);
     }
 
     if (0 == flags.weak_order && firstIter)
     {
-        if (GCFG_ENABLE_DEPENDENCY_CHECKER.value())
+        if (config.dependencyChecker)
         {
             if (firstOpInGroup && groupMaxTargetValue)
             {
@@ -2,6 +2,7 @@
 
 #include <pthread.h>                                                  // for pthread_self
 #include <cstring>                                                    // for memset
+#include <limits>                                                     // for numeric_limits
 #include <memory>                                                     // for __shared_ptr_access
 #include "hcl_config.h"                                               // for HclConfig
 #include "platform/gen2_arch_common/hcl_device_config.h"              // for HclDeviceConfig
@@ -37,6 +38,7 @@ HclDeviceGen2Arch::HclDeviceGen2Arch(const bool                   testCtor,
   m_deviceController(controller),
   m_scalManager(controller.getGen2ArchScalManager()),
   m_commands(controller.getGen2ArchCommands()),
+  m_scaleOutPortHealth(GCFG_HCL_SCALE_OUT_PORT_ERROR_THRESHOLD.value()),
   m_cgSize(0),
   m_serverDef(serverDef),
   m_serverConnectivity(serverDef.getServerConnectivity())
@@ -53,6 +55,7 @@ HclDeviceGen2Arch::HclDeviceGen2Arch(HclDeviceControllerGen2Arch& controller,
   m_deviceController(controller),
   m_scalManager(controller.getGen2ArchScalManager()),
   m_commands(controller.getGen2ArchCommands()),
+  m_scaleOutPortHealth(GCFG_HCL_SCALE_OUT_PORT_ERROR_THRESHOLD.value()),
   m_cgSize(m_scalManager.getCgInfo(0)[(int)hcl::SchedulerType::external].size),
   m_serverDef(serverDef),
   m_serverConnectivity(serverDef.getServerConnectivity())
@@ -120,6 +123,7 @@ uint64_t HclDeviceGen2Arch::getSIBBufferSize() const
 
 HclDeviceGen2Arch::~HclDeviceGen2Arch() noexcept(false)
 {
+    m_metricsExporter.reset();
     delete m_eqHandler;
     delete m_sibContainer;
     delete m_scaleoutProvider;
@@ -349,6 +353,9 @@ void HclDeviceGen2Arch::checkSignals()
 
 hcclResult_t HclDeviceGen2Arch::destroy(bool force)
 {
+    // The exporter samples the scale-out provider, stop it before the provider releases its streams
+    m_metricsExporter.reset();
+
     if (isCommExist(HCL_COMM_WORLD))
     {
         destroyComm(HCL_COMM_WORLD, force);
@@ -426,7 +433,6 @@ void HclDeviceGen2Arch::openAllRequiredNonPeerQPs(const HCL_Comm comm, const std
     LOG_HCL_TRACE(HCL, "comm={}, remoteRanks.size={}", comm, remoteRanks.size());
     if (((HclConfigType)GCFG_BOX_TYPE_ID.value() == LOOPBACK) || GCFG_HCL_NULL_SUBMIT.value()) return;
 
-    const bool         isHnicsScaleout = m_scaleoutProvider->isHostNic();
     UniqueSortedVector nonPeerRemoteRanks;
     for (const HCL_Rank remoteRank : remoteRanks)
     {
@@ -448,6 +454,16 @@ void HclDeviceGen2Arch::openAllRequiredNonPeerQPs(const HCL_Comm comm, const std
     m_scaleoutProvider->openConnectionsOuterRanks(comm, nonPeerRemoteRanks);
 
     LOG_HCL_INFO(HCL, "Open scale-out connections to remote non-peer ranks");
+    exchangeScaleOutConnections(comm, nonPeerRemoteRanks);
+}
+
+/**
+ * @brief exchange the scale-out connections opened to remote ranks with them over the bootstrap network, and move
+ *        them to the remote ranks' connections
+ */
+void HclDeviceGen2Arch::exchangeScaleOutConnections(const HCL_Comm comm, UniqueSortedVector& nonPeerRemoteRanks)
+{
+    const bool isHnicsScaleout = m_scaleoutProvider->isHostNic();
 
     const size_t sendRecvBufSize = isHnicsScaleout ? sizeof(HostNicConnectInfo) : sizeof(RemoteDeviceConnectionInfo);
     std::vector<HostNicConnectInfo> hnicsConnectionInfoBuffers(nonPeerRemoteRanks.size());  // used by host nics
@@ -527,6 +543,143 @@ void HclDeviceGen2Arch::dfa(hl_logger::LoggerSPtr logger)
     m_ethStats.dump(logger, false);
 }
 
+void HclDeviceGen2Arch::onPortStateChange(const uint32_t port, const bool isUp)
+{
+    if (!isScaleOutPort(port)) return;
+
+    if (isUp)
+    {
+        m_scaleOutPortHealth.onPortUp(port);
+    }
+    else
+    {
+        m_scaleOutPortHealth.onPortDown(port);
+    }
+}
+
+nics_mask_t HclDeviceGen2Arch::sampleUnhealthyScaleOutPorts()
+{
+    for (const auto& portErrors : m_ethStats.getErrorCounts())
+    {
+        if (portErrors.first < MAX_NICS_GEN2ARCH && isScaleOutPort(portErrors.first))
+        {
+            m_scaleOutPortHealth.onErrorCount(portErrors.first, portErrors.second);
+        }
+    }
+
+    return m_scaleOutPortHealth.getUnhealthyPorts();
+}
+
+void HclDeviceGen2Arch::setUnhealthyScaleOutPorts(const HCL_Comm comm, const nics_mask_t ports)
+{
+    if (!isScaleOutPortsRebalanceSupported())
+    {
+        if (ports.count() > 0)
+        {
+            LOG_HCL_WARN(HCL,
+                         "comm({}) unhealthy scale-out ports {} cannot be rebalanced on this device, scale-out ports "
+                         "stay {}",
+                         comm,
+                         ports.to_str(),
+                         m_serverConnectivity.getScaleOutPorts(comm).to_str());
+        }
+        return;
+    }
+
+    m_serverConnectivity.setUnhealthyScaleOutPorts(ports, comm);
+}
+
+void HclDeviceGen2Arch::startScaleOutPortHealth()
+{
+    if (!GCFG_HCL_SCALE_OUT_PORT_HEALTH_CHECK.value()) return;
+
+    // The first sample of a port only sets its baseline, errors are counted from here on
+    sampleUnhealthyScaleOutPorts();
+}
+
+void HclDeviceGen2Arch::reconnectScaleOut(const HCL_Comm comm, const nics_mask_t unhealthyPorts)
+{
+    if (!isScaleOutPortsRebalanceSupported() || m_scaleoutProvider->isHostNic())
+    {
+        LOG_HCL_WARN(HCL, "comm({}) scale-out cannot be reconnected on this device, ports stay as they are", comm);
+        return;
+    }
+
+    HclDynamicCommunicator& dynamicComm = getComm(comm);
+    const HCL_Rank          myRank      = getMyRank(comm);
+
+    UniqueSortedVector remoteRanks;
+    for (const HCL_Rank rank : getOpenScaleOutRanks(comm))
+    {
+        if (rank != myRank && !dynamicComm.isRankInsideScaleupGroup(rank)) remoteRanks.insert_sorted(rank);
+    }
+
+    LOG_HCL_INFO(HCL,
+                 "comm({}) reconnecting scale-out to {} remote ranks, unhealthy scale-out ports {}",
+                 comm,
+                 remoteRanks.size(),
+                 unhealthyPorts.to_str());
+
+    // The QPs are closed on the ports they were opened on, which the cached active nics still hold
+    std::shared_ptr<QPManager>& qpManager = m_qpManagers.at(getServerConnectivity().getDefaultScaleOutPortByIndex());
+    for (const HCL_Rank rank : remoteRanks)
+    {
+        qpManager->closeQPs(QPManagerHints(comm, rank));
+        dynamicComm.m_rankInfo.remoteInfo[rank].gaudiNicQPs = {};
+    }
+
+    std::map<std::pair<HCL_Rank, HCL_Rank>, nics_mask_t>& activeNics = m_activeNicsSingleRankCache[comm];
+    for (auto it = activeNics.begin(); it != activeNics.end();)
+    {
+        const bool isScaleUp = dynamicComm.isRankInsideScaleupGroup(it->first.first) &&
+                               dynamicComm.isRankInsideScaleupGroup(it->first.second);
+        it                   = isScaleUp ? std::next(it) : activeNics.erase(it);
+    }
+
+    setUnhealthyScaleOutPorts(comm, unhealthyPorts);
+
+    if (remoteRanks.size() == 0) return;
+
+    m_scaleoutProvider->openConnectionsOuterRanks(comm, remoteRanks);
+    exchangeScaleOutConnections(comm, remoteRanks);
+}
+
+void HclDeviceGen2Arch::startMetricsExporter()
+{
+    if (GCFG_HCL_METRICS_DIR.value().empty() || m_metricsExporter) return;
+
+    // One file per device, so processes driving different devices of the host do not overwrite each other
+    const std::string path = fmt::format("{}/hcl_module{}.prom", GCFG_HCL_METRICS_DIR.value(), getHwModuleId());
+    m_metricsExporter =
+        std::make_unique<HclMetricsExporter>(path, GCFG_HCL_METRICS_INTERVAL_MS.value(), [this](HclMetricsWriter& w) {
+            collectMetrics(w);
+        });
+}
+
+void HclDeviceGen2Arch::collectMetrics(HclMetricsWriter& writer)
+{
+    if (m_sibContainer) m_sibContainer->collectMetrics(writer);
+    if (m_scaleoutProvider) m_scaleoutProvider->collectMetrics(writer);
+
+    const std::vector<EthStats::InterfaceInfo>& interfaces = m_ethStats.getInterfaces();
+    const std::vector<std::vector<uint64_t>>    values     = m_ethStats.getEthStatsVal();
+    for (size_t i = 0; i < interfaces.size(); i++)
+    {
+        const EthStats::InterfaceInfo& interface = interfaces[i];
+        for (size_t stat = 0; stat < interface.statsNames.size() && stat < values[i].size(); stat++)
+        {
+            if (values[i][stat] == std::numeric_limits<uint64_t>::max()) continue;  // failed to read
+
+            writer.untyped("hcl_nic_stat",
+                           "NIC port ethtool statistic",
+                           {{"port", std::to_string(interface.port)},
+                            {"interface", interface.ifName},
+                            {"stat", interface.statsNames[stat]}},
+                           values[i][stat]);
+        }
+    }
+}
+
 void HclDeviceGen2Arch::exportHBMMR()
 {
     if (!getScaleOutProvider()->isHostNic())
@@ -9,6 +9,7 @@
 #include "hl_logger/hllog_core.hpp"  // for logger
 
 #include "platform/gen2_arch_common/eth_stats.hpp"  // EthStats
+#include "platform/gen2_arch_common/scaleout_port_health.h"  // for ScaleOutPortHealth
 #include "hcl_types.h"
 #include "interfaces/hcl_idevice.h"                       // for IHclDevice
 #include "hcl_api_types.h"                                // for HCL_Comm, HCL_Rank
@@ -19,6 +20,7 @@
 #include "platform/gen2_arch_common/scaleout_provider.h"
 #include "platform/gen2_arch_common/qp_manager.h"
 #include "platform/gen2_arch_common/server_connectivity_types.h"  // for DEFAULT_COMM_ID
+#include "infra/hcl_metrics.h"                                    // for HclMetricsExporter
 
 class Gen2ArchDevicePortMapping;
 class HclCommandsGen2Arch;
@@ -101,6 +103,41 @@ public:
     virtual void destroyQp(uint32_t port, uint32_t qpn) override;
     void         dfa(hl_logger::LoggerSPtr logger);
 
+    virtual void onPortStateChange(const uint32_t port, const bool isUp) override;
+
+    /**
+     * @brief Take the baseline of the scale-out ports error counters, so the first communicator already detects the
+     *        errors since device init. Only when HCL_SCALE_OUT_PORT_HEALTH_CHECK is set.
+     */
+    void startScaleOutPortHealth();
+
+    /**
+     * @brief Sample the scale-out ports error counters and return the ports this device considers unhealthy
+     */
+    nics_mask_t sampleUnhealthyScaleOutPorts();
+
+    /**
+     * @brief Set the scale-out ports all ranks of a new communicator agreed to stop using. Called before the
+     *        communicator opens its connections, since the scale-out QPs and their lag indices are programmed then.
+     *        Communicators that are already active keep their ports until they reconnect.
+     */
+    void setUnhealthyScaleOutPorts(const HCL_Comm comm, const nics_mask_t ports);
+
+    /**
+     * @brief Move an active communicator's scale-out connections to the ports left by a new agreement of its ranks.
+     *        All ranks call it at the same collective boundary with their streams idle. The scale-out QPs to every
+     *        remote rank connected so far are closed, reopened on the new ports and exchanged with the remote ranks
+     *        over the bootstrap network, as for non-peer ranks.
+     */
+    void reconnectScaleOut(const HCL_Comm comm, const nics_mask_t unhealthyPorts);
+
+    virtual bool isScaleOutPortsRebalanceSupported() const { return true; }
+
+    /**
+     * @brief Start sampling the device and communicator metrics to HCL_METRICS_DIR, if set
+     */
+    void startMetricsExporter();
+
     /**
      * @brief Maps all HBM allocated by HCL to a dmabuf
      *
@@ -142,12 +179,14 @@ protected:
     virtual void     setEdmaEngineGroupSizes() = 0;
     virtual uint16_t getMaxNumScaleUpPortsPerConnection(const HCL_Comm hclCommId = DEFAULT_COMM_ID) const final;
 
-    hcl::Gen2ArchScalManager&          m_scalManager;
-    IEventQueueHandler*                m_eqHandler = nullptr;
-    HclCommandsGen2Arch&               m_commands;
-    ScaleoutProvider*                  m_scaleoutProvider = nullptr;
-    EthStats                           m_ethStats;
-    std::unique_ptr<SignalsCalculator> m_signalsCalculator;
+    hcl::Gen2ArchScalManager&           m_scalManager;
+    IEventQueueHandler*                 m_eqHandler = nullptr;
+    HclCommandsGen2Arch&                m_commands;
+    ScaleoutProvider*                   m_scaleoutProvider = nullptr;
+    EthStats                            m_ethStats;
+    ScaleOutPortHealth                  m_scaleOutPortHealth;
+    std::unique_ptr<SignalsCalculator>  m_signalsCalculator;
+    std::unique_ptr<HclMetricsExporter> m_metricsExporter;
 
     uint64_t m_allocationRangeStart = -1;  // start of addresses returnable from synDeviceMalloc
     uint64_t m_allocationRangeEnd   = -1;
@@ -167,6 +206,9 @@ protected:
     };
 
 private:
+    void collectMetrics(HclMetricsWriter& writer);
+    void exchangeScaleOutConnections(const HCL_Comm comm, UniqueSortedVector& nonPeerRemoteRanks);
+
     virtual HclConfigType getConfigType()                = 0;
     virtual hcclResult_t  openQpsLoopback(HCL_Comm comm) = 0;
 };
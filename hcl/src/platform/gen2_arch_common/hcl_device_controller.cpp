@@ -5,7 +5,8 @@
 #include "platform/gen2_arch_common/hcl_packets_utils.h"      // for SoBaseAndSize, getCompCfg
 #include "infra/scal/gen2_arch_common/scal_names.h"
 
-HclDeviceControllerGen2Arch::HclDeviceControllerGen2Arch(const unsigned numOfStreams) : m_numOfStreams(numOfStreams)
+HclDeviceControllerGen2Arch::HclDeviceControllerGen2Arch(const unsigned numOfStreams)
+: m_numOfStreams(numOfStreams), m_nullSubmit(GCFG_HCL_NULL_SUBMIT.value())
 {
     m_graphSync        = std::make_unique<std::unique_ptr<HclGraphSyncGen2Arch>[]>(m_numOfStreams);
     m_streamSyncParams = new ArchStreamSyncParams[m_numOfStreams];
@@ -189,7 +190,7 @@ void HclDeviceControllerGen2Arch::advanceProg(int archStreamId, bool nopOp)
 {
     m_streamSyncParams[archStreamId].m_longSo->targetValue++;
 
-    if (!GCFG_HCL_NULL_SUBMIT.value() || nopOp)
+    if (!m_nullSubmit || nopOp)
     {
         m_graphSync[archStreamId]->incSoIndex(1);
     }
@@ -228,8 +229,7 @@ void HclDeviceControllerGen2Arch::addNop(int archStreamId)
     auto& syncParams = getSyncParams(archStreamId);
     syncParams.m_longSoNullSubmit->targetValue++;
 
-    uint64_t targetValue =
-        GCFG_HCL_NULL_SUBMIT.value() ? syncParams.m_longSoNullSubmit->targetValue : syncParams.m_longSo->targetValue;
+    uint64_t targetValue = m_nullSubmit ? syncParams.m_longSoNullSubmit->targetValue : syncParams.m_longSo->targetValue;
 
     LOG_HCL_CONTEXT_INFO(HCL, "Running Nop command, targetValue={}", syncParams.m_longSo->targetValue);
 
@@ -239,7 +239,7 @@ void HclDeviceControllerGen2Arch::addNop(int archStreamId)
               syncParams.m_longSo->long_so_index,
               syncParams.m_longSo->targetValue);
 
-    const unsigned requiredCredits = GCFG_HCL_NULL_SUBMIT.value() ? 1 : handleExtraCredits(archStreamId, 0);
+    const unsigned requiredCredits = m_nullSubmit ? 1 : handleExtraCredits(archStreamId, 0);
 
     // the long SO and the GPSO pool are tightly coupled so we need to move the gpso idx
     syncParams.m_regularGPSOManager->allocNextCredit(syncParams.m_longSo->targetValue);
@@ -325,8 +325,8 @@ void HclDeviceControllerGen2Arch::submitWork(int archStreamId, bool submitToHw)
             }
         }
 
-        uint64_t targetValue = GCFG_HCL_NULL_SUBMIT.value() ? syncParams.m_longSoNullSubmit->targetValue
-                                                            : syncParams.m_longSo->targetValue;
+        uint64_t targetValue =
+            m_nullSubmit ? syncParams.m_longSoNullSubmit->targetValue : syncParams.m_longSo->targetValue;
         if (targetValue - syncParams.m_submittedTargetValue)
         {
             // External CG
@@ -484,7 +484,7 @@ hcl::syncInfo HclDeviceControllerGen2Arch::eventRecord(int      archStreamId,
 {
     auto&                       syncParams = getSyncParams(archStreamId);
     std::lock_guard<std::mutex> lock(syncParams.m_streamLock);
-    if (syncParams.m_isPrevWaitEvent || GCFG_HCL_NULL_SUBMIT.value())
+    if (syncParams.m_isPrevWaitEvent || m_nullSubmit)
     {
         addNop(archStreamId);
         submitWork(archStreamId);
@@ -495,7 +495,7 @@ hcl::syncInfo HclDeviceControllerGen2Arch::eventRecord(int      archStreamId,
               syncParams.m_longSo->long_so_index,
               syncParams.m_longSo->targetValue);
 
-    hcl::syncInfo longSo = GCFG_HCL_NULL_SUBMIT.value() ? *syncParams.m_longSoNullSubmit : *syncParams.m_longSo;
+    hcl::syncInfo longSo = m_nullSubmit ? *syncParams.m_longSoNullSubmit : *syncParams.m_longSo;
 
     if (isCollectTime)
     {
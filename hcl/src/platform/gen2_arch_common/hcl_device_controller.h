@@ -162,6 +162,7 @@ public:
     bool streamQuery(int archStreamId);
 
     void enableNullSubmit(int archStreamId, bool enable);
+    bool isNullSubmit() const { return m_nullSubmit; }
 
     inline hcl::ScalStream& getScalStream(unsigned archStreamIdx, unsigned schedIdx, unsigned streamIdx)
     {
@@ -182,6 +183,7 @@ public:
 
 protected:
     const unsigned                                           m_numOfStreams;
+    const bool                                               m_nullSubmit;  // GCFG_HCL_NULL_SUBMIT, read once
     ArchStreamSyncParams*                                    m_streamSyncParams = nullptr;
     HclDeviceGen2Arch*                                       m_device           = nullptr;
     std::unique_ptr<std::unique_ptr<HclGraphSyncGen2Arch>[]> m_graphSync;
@@ -220,7 +222,7 @@ public:
     ScopedNullSubmit(int archStreamId, HclDeviceControllerGen2Arch& hclDeviceController)
     : m_archStreamId(archStreamId), m_hclDeviceController(hclDeviceController)
     {
-        if (GCFG_HCL_NULL_SUBMIT.value())
+        if (m_hclDeviceController.isNullSubmit())
         {
             m_hclDeviceController.enableNullSubmit(m_archStreamId, true);
         }
@@ -228,7 +230,7 @@ public:
 
     ~ScopedNullSubmit()
     {
-        if (GCFG_HCL_NULL_SUBMIT.value())
+        if (m_hclDeviceController.isNullSubmit())
         {
             m_hclDeviceController.enableNullSubmit(m_archStreamId, false);
         }
@@ -15,7 +15,10 @@
 #include "hcl_global_conf.h"                           // for GCFG_...
 #include "infra/hcl_debug_stats.h"                     // for DEBUG_STATS_...
 
-void HostScheduler::startThread(HclDeviceGen2Arch* device, unsigned index, std::vector<HostStream*>& hostStreams)
+void HostScheduler::startThread(HclDeviceGen2Arch*           device,
+                                unsigned                     index,
+                                std::vector<HostStream*>&    hostStreams,
+                                const std::vector<uint32_t>& preferredCpus)
 {
     m_hostStreams    = hostStreams;
     m_stop           = false;
@@ -23,6 +26,15 @@ void HostScheduler::startThread(HclDeviceGen2Arch* device, unsigned index, std::
     m_index          = index;
     m_sleepThreshold = GCFG_HOST_SCHEDULER_SLEEP_THRESHOLD.value();
     m_sleepDuration  = std::chrono::milliseconds(GCFG_HOST_SCHEDULER_SLEEP_DURATION.value());
+
+    // the thread reads these on every command, copy them instead of going through GCFG
+    m_streamDepthProc            = GCFG_HOST_SCHEDULER_STREAM_DEPTH_PROC.value();
+    m_debugStats                 = GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW;
+    m_ofiDelayMsgThresholdMsec   = GCFG_HOST_SCHEDULER_OFI_DELAY_MSG_THRESHOLD.value();
+    m_ofiDelayAckThresholdMsec   = GCFG_HOST_SCHEDULER_OFI_DELAY_ACK_THRESHOLD.value();
+    m_ofiDelayAckLogIntervalMsec = GCFG_HOST_SCHEDULER_OFI_DELAY_ACK_THRESHOLD_LOG_INTERVAL.value();
+
+    m_thread.setPreferredCpus(preferredCpus);
     m_thread.initialize(m_device->getDeviceConfig().getHwModuleId(),
                         m_device->getDeviceConfig().getHostName(),
                         eHCLProactorThread,
@@ -172,7 +184,7 @@ void HostScheduler::processStream(HostStream* hostStream)
                            hostStream->getStreamName(),
                            srCount,
                            submitTime);
-                    const uint64_t timerThresholdMsec = GCFG_HOST_SCHEDULER_OFI_DELAY_MSG_THRESHOLD.value();
+                    const uint64_t timerThresholdMsec = m_ofiDelayMsgThresholdMsec;
                     if (unlikely(durationMsec >= timerThresholdMsec))
                     {
                         LOG_HCL_WARN(HCL_OFI,
@@ -188,14 +200,14 @@ void HostScheduler::processStream(HostStream* hostStream)
                 {
                     // This code will log a critical error if we are waiting on the SO send ACK for more then threshold
                     // milliseconds
-                    if (unlikely(durationMsec >= GCFG_HOST_SCHEDULER_OFI_DELAY_ACK_THRESHOLD.value()))
+                    if (unlikely(durationMsec >= m_ofiDelayAckThresholdMsec))
                     {
                         // We need to save the the last log time to prevent log flooding
                         static uint64_t lastLogTime      = submitTime;
                         const uint64_t  timeSinceLastLog = currTime - lastLogTime;
 
                         // Print to log only if the time since the last log exceeded the threshold
-                        if (timeSinceLastLog > GCFG_HOST_SCHEDULER_OFI_DELAY_ACK_THRESHOLD_LOG_INTERVAL.value() ||
+                        if (timeSinceLastLog > m_ofiDelayAckLogIntervalMsec ||
                             lastLogTime == submitTime)
                         {
                             LOG_HCL_CRITICAL(HCL_OFI,
@@ -226,7 +238,7 @@ void HostScheduler::processStream(HostStream* hostStream)
         {
             hostStream->getOuterQueue()->free(commandSize >> 2);
 
-            if (unlikely(GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW) && hostStream->getOnGoingProcessing())
+            if (unlikely(m_debugStats) && hostStream->getOnGoingProcessing())
             {
                 std::string srCount = std::to_string(hostStream->getCurrentSrCountProcessing());
                 const char* args[]  = {"srCount", srCount.c_str()};
@@ -251,7 +263,7 @@ bool HostScheduler::processScaleoutWaitForCompCommand(HostStream* hostStream, ui
 {
     host_sched_cmd_wait_for_completion* waitForCompCommand = (host_sched_cmd_wait_for_completion*)m_hostStreamCmd;
 
-    if (unlikely(GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW) && !hostStream->getOnGoingProcessing())
+    if (unlikely(m_debugStats) && !hostStream->getOnGoingProcessing())
     {
         hostStream->setOnGoingProcessing(true);
         hostStream->setCurrentSrCountProcessing(waitForCompCommand->srCount);
@@ -288,7 +300,7 @@ bool HostScheduler::processScaleOutWithFenceCommand(HostStream* hostStream)
     host_sched_cmd_scale_out_with_fence_nic_op* scaleOutCommand =
         (host_sched_cmd_scale_out_with_fence_nic_op*)m_hostStreamCmd;
 
-    if (unlikely(GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW) && !hostStream->getOnGoingProcessing())
+    if (unlikely(m_debugStats) && !hostStream->getOnGoingProcessing())
     {
         hostStream->setOnGoingProcessing(true);
         hostStream->setCurrentSrCountProcessing(scaleOutCommand->srCount);
@@ -297,6 +309,15 @@ bool HostScheduler::processScaleOutWithFenceCommand(HostStream* hostStream)
         HCL_FUNC_INSTRUMENTATION_STRING_START(DEBUG_STATS_LOW, hostStream->getOnGoingFuncName());
     }
 
+    bool     isSend = scaleOutCommand->opcode == HOST_SCHED_CMD_SEND_WITH_FENCE;
+    HCL_Comm comm   = scaleOutCommand->comm;
+
+    // The congestion window is checked before the fence, which must not be triggered twice for one command
+    if (isSend && !m_device->getComm(comm).m_hostNicBridge->acquireSendCredit(scaleOutCommand->qpSetIndex))
+    {
+        return false;
+    }
+
     bool waitOnFence = m_device->getScalManager().hostWaitOnFence(hostStream->getArchStreamIdx(),
                                                                   scaleOutCommand->fenceIdx,
                                                                   scaleOutCommand->askForCredit);
@@ -308,15 +329,16 @@ bool HostScheduler::processScaleOutWithFenceCommand(HostStream* hostStream)
 
     if (waitOnFence)
     {
+        if (isSend)
+        {
+            m_device->getComm(comm).m_hostNicBridge->releaseSendCredit(scaleOutCommand->qpSetIndex);
+        }
         return false;
     }
 
-    bool isSend = scaleOutCommand->opcode == HOST_SCHED_CMD_SEND_WITH_FENCE;
-
     uint64_t address = scaleOutCommand->address;
     int      rank    = scaleOutCommand->rank;
     uint64_t size    = scaleOutCommand->size;
-    HCL_Comm comm    = scaleOutCommand->comm;
 
     hcclHandle   handle;
     hcclResult_t status;
@@ -364,7 +386,7 @@ bool HostScheduler::processScaleOutCommand(HostStream* hostStream)
 {
     host_sched_cmd_scale_out_nic_op* scaleOutCommand = (host_sched_cmd_scale_out_nic_op*)m_hostStreamCmd;
 
-    if (unlikely(GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW) && !hostStream->getOnGoingProcessing())
+    if (unlikely(m_debugStats) && !hostStream->getOnGoingProcessing())
     {
         hostStream->setOnGoingProcessing(true);
         hostStream->setCurrentSrCountProcessing(scaleOutCommand->srCount);
@@ -380,6 +402,11 @@ bool HostScheduler::processScaleOutCommand(HostStream* hostStream)
     uint64_t size    = scaleOutCommand->size;
     HCL_Comm comm    = scaleOutCommand->comm;
 
+    if (isSend && !m_device->getComm(comm).m_hostNicBridge->acquireSendCredit(scaleOutCommand->qpSetIndex))
+    {
+        return false;
+    }
+
     hcclHandle   handle;
     hcclResult_t status;
 
@@ -437,7 +464,7 @@ bool HostScheduler::processFenceWaitCommand(HostStream* hostStream)
 {
     host_sched_cmd_fence_wait* fenceWaitCommand = (host_sched_cmd_fence_wait*)m_hostStreamCmd;
 
-    if (unlikely(GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW) && !hostStream->getOnGoingProcessing())
+    if (unlikely(m_debugStats) && !hostStream->getOnGoingProcessing())
     {
         hostStream->setOnGoingProcessing(true);
         hostStream->setCurrentSrCountProcessing(fenceWaitCommand->srCount);
@@ -461,5 +488,5 @@ bool HostScheduler::processFenceWaitCommand(HostStream* hostStream)
 uint32_t HostScheduler::getStreamDepthProc(HostStream* hostStream)
 {
     const HostStreamType type = hostStream->getType();
-    return (type == HOST_STREAM_SEND || type == HOST_STREAM_RECV) ? GCFG_HOST_SCHEDULER_STREAM_DEPTH_PROC.value() : 1;
+    return (type == HOST_STREAM_SEND || type == HOST_STREAM_RECV) ? m_streamDepthProc : 1;
 }
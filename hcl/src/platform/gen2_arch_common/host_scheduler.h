@@ -140,7 +140,10 @@ public:
 
     void runHostScheduler();
 
-    void startThread(HclDeviceGen2Arch* device, unsigned index, std::vector<HostStream*>& hostStreams);
+    void startThread(HclDeviceGen2Arch*           device,
+                     unsigned                     index,
+                     std::vector<HostStream*>&    hostStreams,
+                     const std::vector<uint32_t>& preferredCpus = {});
     void notifyThread();
     void stopThread();
 
@@ -158,6 +161,11 @@ private:
     std::condition_variable   m_submittedWorkCondVar;
     uint64_t                  m_sleepThreshold;
     std::chrono::milliseconds m_sleepDuration;
+    uint32_t                  m_streamDepthProc            = 1;
+    bool                      m_debugStats                 = false;
+    uint64_t                  m_ofiDelayMsgThresholdMsec   = 0;
+    uint64_t                  m_ofiDelayAckThresholdMsec   = 0;
+    uint64_t                  m_ofiDelayAckLogIntervalMsec = 0;
 
     void     processStream(HostStream* hostStream);
     bool     processScaleOutCommand(HostStream* hostStream);
@@ -49,6 +49,7 @@ public:
     const unsigned     getArchStreamIdx() const { return m_archStreamIdx; }
     const unsigned     getUarchStreamIdx() const { return m_uarchStreamIdx; }
     bool               isEmpty();
+    uint64_t           getQueueDepth() const { return m_outerQueue->getOccupancy(); }
 
     inline uint64_t getCurrentSrCountProcessing() const { return m_currentSrCountProcessing; }
     inline void     setCurrentSrCountProcessing(uint64_t newSrCount) { m_currentSrCountProcessing = newSrCount; }
@@ -6,6 +6,8 @@
 #include "synapse_api.h"           // for synDeviceFree, synDeviceMalloc
 #include "synapse_common_types.h"  // for synStatus
 #include "hcl_types.h"             // for SYN_VALID_DEVICE_ID
+#include "hcl_global_conf.h"       // for GCFG_*
+#include "infra/hcl_metrics.h"     // for HclMetricsWriter
 
 using namespace hcl;
 
@@ -38,6 +40,8 @@ IntermediateBufferContainer::IntermediateBufferContainer(const uint32_t numberOf
         m_lastPool = SCALEOUT_GDR_POOL;
     }
 
+    resolvePoolCounts(firstPool, secondPool);
+
     generatePoolParams(m_imbSize * 2, firstPool, m_bufferContainerParams[0]);
     generatePoolParams(m_imbSize, secondPool, m_bufferContainerParams[1]);
 
@@ -90,6 +94,8 @@ IntermediateBufferContainer::IntermediateBufferContainer(const uint32_t numberOf
 
 IntermediateBufferContainer::~IntermediateBufferContainer()
 {
+    logPoolUsage();
+
     for (unsigned poolSizeIndex = 0; poolSizeIndex < m_bufferContainerParams.size(); poolSizeIndex++)
     {
         synDeviceFree(SYN_VALID_DEVICE_ID, m_bufferContainerParams[poolSizeIndex].allBufferBaseAddr, 0);
@@ -181,3 +187,149 @@ bool IntermediateBufferContainer::verifySIBPoolSizes(const std::vector<e_deviceP
     }
     return true;
 }
+
+void IntermediateBufferContainer::resolvePoolCounts(const std::vector<e_devicePoolID>& firstPool,
+                                                    const std::vector<e_devicePoolID>& secondPool)
+{
+    // Minimal amount of credits kept per shrinkable pool, so consecutive collectives can still be pipelined
+    static constexpr unsigned MIN_POOL_CREDITS = 2;
+
+    std::array<unsigned, MAX_NUM_POOLS> counts      = {};
+    std::array<uint64_t, MAX_NUM_POOLS> sliceSizes  = {};
+    std::vector<e_devicePoolID>         shrinkables = {};
+
+    for (const e_devicePoolID pool : firstPool)
+    {
+        counts[pool]     = hcl::IntermediateBuffersAmount::getDefaultBufferCount(pool);
+        sliceSizes[pool] = m_imbSize * 2;
+    }
+    for (const e_devicePoolID pool : secondPool)
+    {
+        counts[pool]     = hcl::IntermediateBuffersAmount::getDefaultBufferCount(pool);
+        sliceSizes[pool] = m_imbSize;
+    }
+
+    if (GCFG_HCL_IMB_SCALEOUT_POOL_COUNT.value() != 0)
+    {
+        counts[SCALEOUT_POOL] = GCFG_HCL_IMB_SCALEOUT_POOL_COUNT.value();
+    }
+    if (GCFG_HCL_IMB_SCALEUP_POOL_COUNT.value() != 0)
+    {
+        counts[SCALEUP_AND_ALL2ALL_POOL] = GCFG_HCL_IMB_SCALEUP_POOL_COUNT.value();
+    }
+
+    shrinkables.push_back(SCALEOUT_POOL);
+    shrinkables.push_back(SCALEUP_AND_ALL2ALL_POOL);
+    if (GCFG_HCCL_GAUDI_DIRECT.value())
+    {
+        shrinkables.push_back(SCALEOUT_GDR_POOL);
+    }
+
+    auto totalSize = [&]() {
+        uint64_t size = 0;
+        for (unsigned pool = 0; pool < MAX_NUM_POOLS; pool++)
+        {
+            size += counts[pool] * sliceSizes[pool];
+        }
+        return size * m_numberOfStreams;
+    };
+
+    const uint64_t budget = GCFG_HCL_IMB_HBM_BUDGET.value();
+    if (budget != 0)
+    {
+        // Release one credit at a time from the pool that currently holds the most HBM
+        while (totalSize() > budget)
+        {
+            e_devicePoolID victim     = NO_POOL;
+            uint64_t       victimSize = 0;
+            for (const e_devicePoolID pool : shrinkables)
+            {
+                const unsigned factor   = DeviceBufferManager::getFactor(pool);
+                const uint64_t poolSize = counts[pool] * sliceSizes[pool];
+                if (counts[pool] >= factor * (MIN_POOL_CREDITS + 1) && poolSize > victimSize)
+                {
+                    victim     = pool;
+                    victimSize = poolSize;
+                }
+            }
+
+            if (victim == NO_POOL)
+            {
+                // Every shrinkable pool is at its minimum, this is the smallest layout that can run
+                LOG_HCL_ERR(HCL,
+                            "HCL_IMB_HBM_BUDGET({:g}MB) is too small, using the minimal IMB footprint of {:g}MB",
+                            B2MB(budget),
+                            B2MB(totalSize()));
+                break;
+            }
+            counts[victim] -= DeviceBufferManager::getFactor(victim);
+        }
+    }
+
+    for (const e_devicePoolID pool : shrinkables)
+    {
+        VERIFY(counts[pool] >= DeviceBufferManager::getFactor(pool) * MIN_POOL_CREDITS,
+               "pool {} count({}) must hold at least {} credits",
+               pool,
+               counts[pool],
+               MIN_POOL_CREDITS);
+        hcl::IntermediateBuffersAmount::setBufferCount(pool, counts[pool]);
+    }
+
+    LOG_HCL_INFO(HCL,
+                 "IMB pool counts: scaleout={}, reduce={}, scaleup={}, gdr={}, total size per device {:g}MB",
+                 counts[SCALEOUT_POOL],
+                 counts[REDUCE_POOL],
+                 counts[SCALEUP_AND_ALL2ALL_POOL],
+                 counts[SCALEOUT_GDR_POOL],
+                 B2MB(totalSize()));
+}
+
+void IntermediateBufferContainer::logPoolUsage()
+{
+    for (size_t streamIndex = 0; streamIndex < m_sibBuffers.size(); streamIndex++)
+    {
+        for (int pool = m_firstPool; pool < m_lastPool + 1; pool++)
+        {
+            const e_devicePoolID poolId      = static_cast<e_devicePoolID>(pool);
+            const uint64_t       allocations = m_sibBuffers[streamIndex].getAllocationCount(poolId);
+            if (allocations == 0)
+            {
+                continue;
+            }
+            LOG_HCL_INFO(HCL,
+                         "IMB usage: stream {}, pool {}, count {}, allocations {}, stalls {}",
+                         streamIndex,
+                         pool,
+                         hcl::IntermediateBuffersAmount::getBufferCount(poolId),
+                         allocations,
+                         m_sibBuffers[streamIndex].getStallCount(poolId));
+        }
+    }
+}
+
+void IntermediateBufferContainer::collectMetrics(HclMetricsWriter& writer)
+{
+    for (size_t streamIndex = 0; streamIndex < m_sibBuffers.size(); streamIndex++)
+    {
+        for (int pool = m_firstPool; pool < m_lastPool + 1; pool++)
+        {
+            const e_devicePoolID           poolId = static_cast<e_devicePoolID>(pool);
+            const HclMetricsWriter::Labels labels = {{"stream", std::to_string(streamIndex)},
+                                                     {"pool", std::to_string(pool)}};
+
+            writer.gauge("hcl_imb_pool_buffers",
+                         "Intermediate buffers in the pool",
+                         labels,
+                         hcl::IntermediateBuffersAmount::getBufferCount(poolId));
+            writer.counter("hcl_imb_allocations_total",
+                           "Intermediate buffer allocations",
+                           labels,
+                           m_sibBuffers[streamIndex].getAllocationCount(poolId));
+            writer.counter("hcl_imb_stalls_total",
+                           "Intermediate buffer allocations that waited for a buffer to be released",
+                           labels,
+                           m_sibBuffers[streamIndex].getStallCount(poolId));
+        }
+    }
+}
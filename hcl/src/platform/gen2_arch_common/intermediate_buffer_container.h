@@ -1,10 +1,13 @@
 #pragma once
 
 #include "platform/gen2_arch_common/device_buffer_manager.h"
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <map>
 
+class HclMetricsWriter;
+
 namespace hcl
 {
 constexpr unsigned MAX_NUM_POOLS = 20;
@@ -16,7 +19,10 @@ struct IntermediateBuffersAmount
          {SCALEUP_AND_ALL2ALL_POOL, 104},
          {SCALEOUT_GDR_POOL, 40}}};
 
-    static int getBufferCount(e_devicePoolID key)
+    // Counts resolved at IMB allocation time (user overrides / HBM budget). 0 means "use buffersArr default"
+    static inline std::array<unsigned, MAX_NUM_POOLS> s_resolvedCounts = {};
+
+    static int getDefaultBufferCount(e_devicePoolID key)
     {
         for (const auto& pair : buffersArr)
         {
@@ -27,6 +33,17 @@ struct IntermediateBuffersAmount
         }
         return -1;  // not found
     }
+
+    static int getBufferCount(e_devicePoolID key)
+    {
+        if (key >= 0 && key < (int)MAX_NUM_POOLS && s_resolvedCounts[key] != 0)
+        {
+            return s_resolvedCounts[key];
+        }
+        return getDefaultBufferCount(key);
+    }
+
+    static void setBufferCount(e_devicePoolID key, unsigned count) { s_resolvedCounts.at(key) = count; }
 };
 
 struct BufferContainerParams
@@ -43,6 +60,9 @@ struct BufferContainerParams
     Each range is divided to 3 smaller ranges to be used per stream (managed by DeviceBufferManager).
     DeviceBufferManager can contain many pool types (REDUCE_POOL/SCALEUP_AND_ALL2ALL_POOL/SCALEOUT_POOL) and
     different pool sizes. SCALEOUT_POOL - 1M buffers. REDUCE_POOL/SCALEUP_AND_ALL2ALL_POOL - 512k buffers.
+    Pool counts default to IntermediateBuffersAmount::buffersArr, can be overridden by the user and are shrunk
+    (in credit granularity) to fit HCL_IMB_HBM_BUDGET. All streams share the same layout since slice ids are
+    computed as streamId * countOfSIB.
 */
 class IntermediateBufferContainer
 {
@@ -69,6 +89,10 @@ public:
      */
     uint32_t getSizeOfAllBuffers(unsigned poolSizeIndex) const;
     bool     verifySIBPoolSizes(const std::vector<e_devicePoolID>& pools);
+    void     resolvePoolCounts(const std::vector<e_devicePoolID>& firstPool,
+                               const std::vector<e_devicePoolID>& secondPool);
+    void     logPoolUsage();
+    void     collectMetrics(HclMetricsWriter& writer);
 
     inline e_devicePoolID getFirstPool() { return m_firstPool; };
     inline e_devicePoolID getLastPool() { return m_lastPool; };
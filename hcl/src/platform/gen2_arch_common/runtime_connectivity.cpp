@@ -12,6 +12,7 @@
 #include "platform/gen2_arch_common/server_connectivity_user_config.h"  // for ServerConnectivityUserConfig
 #include "platform/gen2_arch_common/server_connectivity.h"              // for Gen2ArchServerConnectivity
 #include "platform/gen2_arch_common/runtime_connectivity.h"             // for Gen2ArchRuntimeConnectivity
+#include "platform/gen2_arch_common/scaleout_port_health.h"             // for assignScaleOutPorts
 
 #include "hcl_utils.h"        // for VERIFY
 #include "hcl_log_manager.h"  // for LOG_*
@@ -150,7 +151,8 @@ void Gen2ArchRuntimeConnectivity::setPortsMasks()
                       logicalScaleoutPortsMask.to_str());
         scaleOutPortsMask &= logicalScaleoutPortsMask;
     }
-    m_enabled_external_ports_mask = m_serverConnectivity.getLkdEnabledScaleoutPorts() & scaleOutPortsMask;
+    m_enabled_external_ports_mask    = m_serverConnectivity.getLkdEnabledScaleoutPorts() & scaleOutPortsMask;
+    m_configured_external_ports_mask = m_enabled_external_ports_mask;
 
     // Define if scaleout global context should be updated - per user request & LKD ports mask
     setUpdateScaleOutGlobalContextRequired(m_serverConnectivity.getLkdEnabledScaleoutPorts(), scaleOutPortsMask);
@@ -349,36 +351,15 @@ void Gen2ArchRuntimeConnectivity::readAllPorts()
 
 void Gen2ArchRuntimeConnectivity::setNumScaleOutPorts()
 {
-    uint16_t sub_port_index_min = 0;
-    uint16_t sub_port_index_max = m_serverConnectivity.getMaxNumScaleOutPorts() - 1;  // Includes LKD mask
+    // collect all ports that are pre-defined as scaleout ports and enabled in hl-thunk port mask. Accordingly to FW
+    // implementation, the port with the lowest sub port index will be used for scaleout if some of the ports were
+    // disabled.
+    ScaleOutPortAssignment assignment = assignScaleOutPorts(m_fullScaleoutPorts,
+                                                            m_enabled_external_ports_mask,
+                                                            m_serverConnectivity.getMaxNumScaleOutPorts());
+    m_enabled_scaleout_ports     = assignment.enabledPorts;
+    m_enabled_scaleout_sub_ports = std::move(assignment.subPorts);
 
-    // collect all ports that are pre-defined as scaleout ports and enabled in hl-thunk port mask
-    for (uint16_t port_index = 0; port_index < MAX_NICS_GEN2ARCH; port_index++)
-    {
-        if (isScaleoutPort(port_index))
-        {
-            // Accordingly to FW implementation, the port with the lowest sub port index
-            // will be used for scaleout if some of the ports were disabled.
-            // Example:
-            // |         sub port indices      |    number of used ports   |         active ports        |
-            // +-------------------------------+---------------------------+-----------------------------+
-            // |        8->2, 22->0, 23->1     |             2             |             22,23           |
-            // +-------------------------------+---------------------------+-----------------------------+
-            // |        8->2, 22->0, 23->1     |             1             |               22            |
-            // +-------------------------------+---------------------------+-----------------------------+
-            if (m_enabled_external_ports_mask[port_index])
-            {
-                m_enabled_scaleout_ports[port_index] = true;
-                m_enabled_scaleout_sub_ports.insert(std::make_pair(port_index, sub_port_index_min));
-                sub_port_index_min++;
-            }
-            else
-            {
-                m_enabled_scaleout_sub_ports.insert(std::make_pair(port_index, sub_port_index_max));
-                sub_port_index_max--;
-            }
-        }
-    }
     LOG_HCL_INFO(HCL,
                  "Enabled number of scaleout ports for comm {} by LKD/user mask is: {} out of {} possible.",
                  m_hclCommId,
@@ -390,6 +371,57 @@ void Gen2ArchRuntimeConnectivity::setNumScaleOutPorts()
     }
 }
 
+bool Gen2ArchRuntimeConnectivity::setUnhealthyScaleOutPorts(const nics_mask_t unhealthyPorts)
+{
+    const nics_mask_t externalPorts = selectHealthyScaleOutPorts(m_configured_external_ports_mask, unhealthyPorts);
+    if (externalPorts == m_configured_external_ports_mask && (externalPorts & unhealthyPorts) != 0)
+    {
+        LOG_HCL_WARN(HCL,
+                     "m_hclCommId={}, all scale-out ports {} are unhealthy, keeping them",
+                     m_hclCommId,
+                     m_configured_external_ports_mask.to_str());
+    }
+
+    if (externalPorts == m_enabled_external_ports_mask)
+    {
+        return false;
+    }
+
+    // Surviving ports get consecutive sub port indices, as if the unhealthy ones were masked by the user
+    m_enabled_external_ports_mask = externalPorts;
+    setNumScaleOutPorts();
+
+    LOG_HCL_WARN(HCL,
+                 "m_hclCommId={}, scale-out ports rebalanced to {} out of {}, unhealthy ports {}",
+                 m_hclCommId,
+                 m_enabled_scaleout_ports.to_str(),
+                 m_configured_external_ports_mask.to_str(),
+                 unhealthyPorts.to_str());
+    return true;
+}
+
+nics_mask_t Gen2ArchRuntimeConnectivity::getLogicalScaleOutPorts(const nics_mask_t ports) const
+{
+    nics_mask_t logicalPorts;
+    unsigned    logicalIndex = 0;
+    for (auto port : m_fullScaleoutPorts)
+    {
+        logicalPorts.set(logicalIndex++, ports[port]);
+    }
+    return logicalPorts;
+}
+
+nics_mask_t Gen2ArchRuntimeConnectivity::getPhysicalScaleOutPorts(const nics_mask_t logicalPorts) const
+{
+    nics_mask_t ports;
+    unsigned    logicalIndex = 0;
+    for (auto port : m_fullScaleoutPorts)
+    {
+        ports.set(port, logicalPorts[logicalIndex++]);
+    }
+    return ports;
+}
+
 uint16_t Gen2ArchRuntimeConnectivity::getNumScaleUpPorts() const
 {
     return m_enabled_scaleup_ports.count();
@@ -54,6 +54,15 @@ public:
     virtual uint32_t  getBackpressureOffset(const uint16_t nic) const = 0;
     virtual uint16_t  getMaxNumScaleUpPortsPerConnection() const      = 0;
 
+    /**
+     * @brief Recalculate the scale-out ports without the unhealthy ones
+     * @param unhealthyPorts - ports to stop using, an empty mask restores all configured ports
+     * @return true if the enabled scale-out ports changed
+     */
+    bool        setUnhealthyScaleOutPorts(const nics_mask_t unhealthyPorts);
+    nics_mask_t getLogicalScaleOutPorts(const nics_mask_t ports) const;          // port bits -> scaleout index bits
+    nics_mask_t getPhysicalScaleOutPorts(const nics_mask_t logicalPorts) const;  // scaleout index bits -> port bits
+
 protected:
     bool         isPortConnected(const uint16_t port) const;
     virtual void initServerSpecifics() = 0;
@@ -65,6 +74,7 @@ protected:
     // Vars per comm
     ServerNicsConnectivityArray            m_mappings;
     nics_mask_t                            m_enabled_external_ports_mask = 0;  // After masking by LKD & HCL
+    nics_mask_t m_configured_external_ports_mask = 0;  // After masking by LKD & HCL, before unhealthy ports
     uint16_t                               m_maxSubNicScaleup            = 0;  // w/o any masks
     uint16_t                               m_maxSubNicScaleout           = 0;  // w/o any masks
     nics_mask_t                            m_enabled_scaleup_ports;            // w/o any masks
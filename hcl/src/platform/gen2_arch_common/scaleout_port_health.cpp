@@ -0,0 +1,115 @@
+#include "platform/gen2_arch_common/scaleout_port_health.h"
+
+#include "hcl_log_manager.h"  // for LOG_*
+
+static bool isValidPort(const uint16_t port)
+{
+    if (port >= MAX_NICS_GEN2ARCH)
+    {
+        LOG_WARN(HCL, "Ignoring invalid scale-out port {}", port);
+        return false;
+    }
+    return true;
+}
+
+void ScaleOutPortHealth::onPortDown(const uint16_t port)
+{
+    if (!isValidPort(port)) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_downPorts[port])
+    {
+        LOG_WARN(HCL, "Scale-out port {} link is down", port);
+    }
+    m_downPorts.set(port);
+}
+
+void ScaleOutPortHealth::onPortUp(const uint16_t port)
+{
+    if (!isValidPort(port)) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_downPorts[port])
+    {
+        LOG_INFO(HCL, "Scale-out port {} link is up", port);
+    }
+    m_downPorts.clear(port);
+}
+
+void ScaleOutPortHealth::onErrorCount(const uint16_t port, const uint64_t errorCount)
+{
+    if (!isValidPort(port)) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PortErrorState&             state = m_errorStates[port];
+
+    // Counters are reset when the driver reloads the port, treat that as a new baseline
+    if (!state.valid || errorCount < state.errorCount)
+    {
+        state = {true, errorCount, 0};
+        return;
+    }
+
+    const uint64_t newErrors = errorCount - state.errorCount;
+    state.errorCount         = errorCount;
+
+    if (m_errorThreshold > 0 && newErrors >= m_errorThreshold)
+    {
+        if (!m_degradedPorts[port])
+        {
+            LOG_WARN(HCL, "Scale-out port {} is degraded, {} new errors since last sample", port, newErrors);
+        }
+        m_degradedPorts.set(port);
+        state.cleanSamples = 0;
+    }
+    else if (newErrors > 0)
+    {
+        state.cleanSamples = 0;
+    }
+    else if (m_degradedPorts[port] && ++state.cleanSamples >= CLEAN_SAMPLES_TO_RECOVER)
+    {
+        LOG_INFO(HCL, "Scale-out port {} recovered after {} clean samples", port, state.cleanSamples);
+        m_degradedPorts.clear(port);
+    }
+}
+
+nics_mask_t ScaleOutPortHealth::getUnhealthyPorts() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_downPorts | m_degradedPorts;
+}
+
+nics_mask_t selectHealthyScaleOutPorts(const nics_mask_t configuredPorts, const nics_mask_t unhealthyPorts)
+{
+    const nics_mask_t healthyPorts = configuredPorts & ~unhealthyPorts;
+    return healthyPorts.count() == 0 ? configuredPorts : healthyPorts;
+}
+
+ScaleOutPortAssignment
+assignScaleOutPorts(const nics_mask_t scaleOutPorts, const nics_mask_t enabledPorts, const uint16_t maxSubPorts)
+{
+    ScaleOutPortAssignment assignment;
+    uint16_t               subPortIndexMin = 0;
+    uint16_t               subPortIndexMax = maxSubPorts - 1;
+
+    // Example:
+    // |         sub port indices      |    number of used ports   |         active ports        |
+    // +-------------------------------+---------------------------+-----------------------------+
+    // |        8->2, 22->0, 23->1     |             2             |             22,23           |
+    // +-------------------------------+---------------------------+-----------------------------+
+    // |        8->2, 22->0, 23->1     |             1             |               22            |
+    // +-------------------------------+---------------------------+-----------------------------+
+    for (auto port : scaleOutPorts)
+    {
+        if (enabledPorts[port])
+        {
+            assignment.enabledPorts[port] = true;
+            assignment.subPorts.emplace(port, subPortIndexMin++);
+        }
+        else
+        {
+            assignment.subPorts.emplace(port, subPortIndexMax--);
+        }
+    }
+    return assignment;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>          // for array
+#include <cstdint>        // for uint*_t
+#include <mutex>          // for mutex
+#include <unordered_map>  // for unordered_map
+
+#include "hcl_bits.h"                         // for nics_mask_t
+#include "platform/gen2_arch_common/types.h"  // for MAX_NICS_GEN2ARCH
+
+/**
+ * @brief Tracks the health of the scale-out ports of a device.
+ *
+ * A port is unhealthy while its link is down (NIC event queue) or while its error counters keep growing (ethtool
+ * statistics). Link events arrive on the event queue thread and counter samples on the API thread, so the state is
+ * guarded by a mutex. The tracker only reports; deciding which ports to stop using is left to the caller.
+ */
+class ScaleOutPortHealth
+{
+public:
+    // Consecutive clean counter samples before a degraded port is considered healthy again
+    static constexpr unsigned CLEAN_SAMPLES_TO_RECOVER = 3;
+
+    ScaleOutPortHealth(const uint64_t errorThreshold) : m_errorThreshold(errorThreshold) {}
+
+    void onPortDown(const uint16_t port);
+    void onPortUp(const uint16_t port);
+
+    /**
+     * @brief Feed a cumulative error counter sample of a port
+     * @param port - NIC port
+     * @param errorCount - sum of the error counters of the port since driver load
+     */
+    void onErrorCount(const uint16_t port, const uint64_t errorCount);
+
+    nics_mask_t getUnhealthyPorts() const;
+
+private:
+    struct PortErrorState
+    {
+        bool     valid        = false;  // first sample only sets the baseline
+        uint64_t errorCount   = 0;
+        unsigned cleanSamples = 0;
+    };
+
+    const uint64_t m_errorThreshold;
+
+    mutable std::mutex                            m_mutex;
+    nics_mask_t                                   m_downPorts;
+    nics_mask_t                                   m_degradedPorts;
+    std::array<PortErrorState, MAX_NICS_GEN2ARCH> m_errorStates = {};
+};
+
+/**
+ * @brief The scale-out ports a communicator sends on, and the sub port index of every scale-out port
+ */
+struct ScaleOutPortAssignment
+{
+    nics_mask_t                            enabledPorts;
+    std::unordered_map<uint16_t, uint16_t> subPorts;  // Key => Port, Value => sub port index
+};
+
+/**
+ * @brief Drop the unhealthy ports from the configured scale-out ports. When all of them are unhealthy they are all
+ *        kept, since a communicator cannot run without scale-out ports.
+ */
+nics_mask_t selectHealthyScaleOutPorts(const nics_mask_t configuredPorts, const nics_mask_t unhealthyPorts);
+
+/**
+ * @brief Spread scale-out traffic over the enabled ports. As in the FW, enabled ports get the lowest sub port indices
+ *        in port order and the other scale-out ports the highest ones, so traffic of a disabled port moves to the
+ *        remaining ones.
+ * @param scaleOutPorts - all scale-out ports of the device, regardless of masks
+ * @param enabledPorts - the scale-out ports to use
+ * @param maxSubPorts - number of sub port indices, the scale-out ports enabled by LKD
+ */
+ScaleOutPortAssignment
+assignScaleOutPorts(const nics_mask_t scaleOutPorts, const nics_mask_t enabledPorts, const uint16_t maxSubPorts);
@@ -6,6 +6,9 @@
 #include <exception>
 #include <iterator>
 #include <memory>
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
 #include "hccl/ofi_communicator.h"
 #include "hcl_dynamic_communicator.h"
 #include "hcl_global_conf.h"
@@ -25,7 +28,9 @@
 #include "hcl_log_manager.h"                             // for LOG_*
 #include "hcl_types.h"                                   // for HostNicConnectInfo
 #include "hcl_math_utils.h"
+#include "infra/hcl_metrics.h"  // for HclMetricsWriter
 #include "libfabric/mr_mapping.h"
+#include "libfabric/hl_topo.h"  // for getNumaNodeCpus, bindMemoryToNumaNode
 #include "platform/gen2_arch_common/server_connectivity.h"  // for Gen2ArchServerConnectivity
 
 ScaleoutProvider::ScaleoutProvider(HclDeviceGen2Arch* device) : m_device(device) {}
@@ -241,6 +246,60 @@ unsigned Gen2ArchScaleoutProvider::getNumOfNicsPerDevice(const HCL_Comm comm) co
     return m_device->getServerConnectivity().getNumScaleOutPorts(comm);
 }
 
+/**
+ * Allocate the host NIC staging memory. Huge pages are used when available, explicit ones first and transparent ones
+ * otherwise, and the pages are bound to numaNode before they are first touched by the device mapping.
+ * Explicit huge pages are reserved from the pool of all nodes when they are mapped, so numaNode is only preferred for
+ * them - a strict bind to a node without free huge pages would fail the first touch with SIGBUS.
+ * length is updated with the actual allocation size.
+ */
+static void* allocStagingMemory(uint64_t& length, const int numaNode, std::string& pageDescription)
+{
+    static constexpr uint64_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    void* hostAddr  = MAP_FAILED;
+    bool  hugetlb   = false;
+    pageDescription = "regular pages";
+    if (GCFG_HCL_HNIC_STAGING_HUGE_PAGES.value())
+    {
+        const uint64_t hugeLength = round_to_multiple(length, HUGE_PAGE_SIZE);
+        hostAddr = mmap(nullptr, hugeLength, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (hostAddr != MAP_FAILED && madvise(hostAddr, hugeLength, MADV_DONTFORK) != 0)
+        {
+            munmap(hostAddr, hugeLength);
+            hostAddr = MAP_FAILED;
+        }
+
+        if (hostAddr != MAP_FAILED)
+        {
+            length          = hugeLength;
+            hugetlb         = true;
+            pageDescription = "huge pages";
+        }
+        else
+        {
+            LOG_DEBUG(HCL, "No huge pages available for host NIC staging buffers ({})", std::strerror(errno));
+        }
+    }
+
+    if (hostAddr == MAP_FAILED)
+    {
+        hostAddr =
+            alloc_mem_to_be_mapped_to_device(length, nullptr, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS);
+        if (GCFG_HCL_HNIC_STAGING_HUGE_PAGES.value() && madvise(hostAddr, length, MADV_HUGEPAGE) == 0)
+        {
+            pageDescription = "transparent huge pages";
+        }
+    }
+
+    if (GCFG_HCL_HNIC_NUMA_AFFINITY.value() && !hl_topo::bindMemoryToNumaNode(hostAddr, length, numaNode, !hugetlb))
+    {
+        pageDescription += ", not NUMA bound";
+    }
+
+    return hostAddr;
+}
+
 LibfabricScaleoutProvider::LibfabricScaleoutProvider(HclDeviceGen2Arch* device)
 : ScaleoutProvider(device), m_numArchStreams(device->getHal()->getMaxStreams())
 {
@@ -250,18 +309,26 @@ LibfabricScaleoutProvider::LibfabricScaleoutProvider(HclDeviceGen2Arch* device)
     m_hostStreamVec.resize(m_numArchStreams);
     uint64_t sizeOfHostBufferPool = 0;
     m_isGaudiDirect               = ofi_t::isGaudiDirect();
+
+    const int                   nicNumaNode = device->getOfiHandle()->getNicNumaNode();
+    const std::vector<uint32_t> nicNumaCpus =
+        GCFG_HCL_HNIC_NUMA_AFFINITY.value() ? hl_topo::getNumaNodeCpus(nicNumaNode) : std::vector<uint32_t> {};
     if (!isGaudiDirect())
     {
         sizeOfHostBufferPool = device->getSIBBufferSize() * (HostBuffersAmount::getBufferCount(HNIC_SEND_POOL) +
                                                              HostBuffersAmount::getBufferCount(HNIC_RECV_POOL));
         uint64_t sizeOfAllHostBuffers = m_numArchStreams * sizeOfHostBufferPool;
 
-        m_hostAddress            = alloc_and_map_to_device(sizeOfAllHostBuffers,
-                                                m_deviceHandle,
-                                                m_device->getDeviceConfig().getFd(),
-                                                nullptr,
-                                                PROT_READ | PROT_WRITE,
-                                                MAP_SHARED | MAP_ANONYMOUS);
+        std::string stagingPages;
+        m_hostAllocSize = sizeOfAllHostBuffers;
+        m_hostAddress   = allocStagingMemory(m_hostAllocSize, nicNumaNode, stagingPages);
+        map_host_mem_to_device(m_hostAddress, m_hostAllocSize, m_deviceHandle, m_device->getDeviceConfig().getFd());
+        LOG_HCL_INFO(HCL,
+                     "Host NIC staging buffers: {} bytes on NUMA node {} using {}",
+                     m_hostAllocSize,
+                     nicNumaNode,
+                     stagingPages);
+
         struct fid_mr* mr_handle = nullptr;
         if (ofi_t::isMRLocal())
         {
@@ -350,8 +417,15 @@ LibfabricScaleoutProvider::LibfabricScaleoutProvider(HclDeviceGen2Arch* device)
             archStream++;
         }
 
-        m_hostScheduler.at(hostSchedId)->startThread(device, hostSchedId, hostStreamVec);
+        m_hostScheduler.at(hostSchedId)->startThread(device, hostSchedId, hostStreamVec, nicNumaCpus);
     }
+
+    LOG_HCL_INFO(HCL,
+                 "Host schedulers: {} threads on NUMA node {} ({} CPUs{})",
+                 m_hostScheduler.size(),
+                 nicNumaNode,
+                 nicNumaCpus.size(),
+                 GCFG_USE_CPU_AFFINITY.value() ? ", priority CPU pinning takes precedence" : "");
 }
 
 LibfabricScaleoutProvider::~LibfabricScaleoutProvider()
@@ -372,14 +446,7 @@ void LibfabricScaleoutProvider::destroy()
     }
     if (!isGaudiDirect())
     {
-        uint64_t sizeOfHostBufferPool =
-            m_device->getSIBBufferSize() *
-            (HostBuffersAmount::getBufferCount(HNIC_SEND_POOL) + HostBuffersAmount::getBufferCount(HNIC_RECV_POOL));
-        uint64_t sizeOfAllHostBuffers = m_numArchStreams * sizeOfHostBufferPool;
-        free_mem_mapped_to_device(m_hostAddress,
-                                  sizeOfAllHostBuffers,
-                                  m_deviceHandle,
-                                  m_device->getDeviceConfig().getFd());
+        free_mem_mapped_to_device(m_hostAddress, m_hostAllocSize, m_deviceHandle, m_device->getDeviceConfig().getFd());
     }
 
     for (unsigned i = 0; i < m_hostBufferManager.size(); i++)
@@ -418,6 +485,25 @@ HostBufferManager* LibfabricScaleoutProvider::getHostBufferManager(unsigned stre
     return m_hostBufferManager.at(streamIdx);
 }
 
+void LibfabricScaleoutProvider::collectMetrics(HclMetricsWriter& writer)
+{
+    for (unsigned archStream = 0; archStream < m_numArchStreams; archStream++)
+    {
+        for (size_t uarchStream = 0;
+             uarchStream < (GCFG_ENABLE_HNIC_MICRO_STREAMS.value() ? HOST_MICRO_ARCH_STREAMS : 1);
+             uarchStream++)
+        {
+            for (const HostStream* hostStream : m_hostStreamVec[archStream][uarchStream])
+            {
+                writer.gauge("hcl_host_stream_queue_dwords",
+                             "Dwords queued to a host NIC stream and not yet processed",
+                             {{"stream", hostStream->getStreamName()}},
+                             hostStream->getQueueDepth());
+            }
+        }
+    }
+}
+
 void LibfabricScaleoutProvider::openConnectionsOuterRanks(const HCL_Comm comm, const UniqueSortedVector& outerRanks)
 {
     LOG_HCL_TRACE(HCL, "comm={}, outerRanks=[ {} ]", comm, outerRanks);
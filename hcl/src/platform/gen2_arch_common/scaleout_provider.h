@@ -19,6 +19,7 @@ class HostScheduler;
 class HostBufferManager;
 class SignalsManager;
 class ofi_t;  // for getOfiHandle()
+class HclMetricsWriter;
 
 constexpr unsigned MAX_NUM_POOLS = 20;
 struct HostBuffersAmount
@@ -60,6 +61,7 @@ public:
     virtual void               requestScaleoutResources(NonCollectiveState& nonCollectiveState)                 = 0;
     virtual unsigned           getNumOfNicsPerDevice(const HCL_Comm comm) const                                 = 0;
     virtual HostBufferManager* getHostBufferManager(unsigned streamIdx);
+    virtual void               collectMetrics(HclMetricsWriter& writer) {}
 
     static ScaleoutProvider* createScaleOutProvider(HclDeviceGen2Arch* device);
 
@@ -113,11 +115,13 @@ public:
     void             notifyHostScheduler(int archStreamIdx);
 
     virtual HostBufferManager* getHostBufferManager(unsigned streamIdx) override;
+    virtual void               collectMetrics(HclMetricsWriter& writer) override;
 
     std::vector<std::array<std::array<HostStream*, NUM_HOST_STREAMS>, HOST_MICRO_ARCH_STREAMS>> m_hostStreamVec;
 
     uint64_t m_deviceHandle;
     void*    m_hostAddress;
+    uint64_t m_hostAllocSize = 0;
     unsigned m_streamsPerHostSched;
     uint64_t m_numArchStreams;
 
@@ -74,6 +74,7 @@ Gen2ArchServerConnectivity::Gen2ArchServerConnectivity(const int
 void Gen2ArchServerConnectivity::init(const bool readLkdPortsMask)
 {
     LOG_HCL_DEBUG(HCL, "Started, m_moduleId={}, m_fd={}, readLkdPortsMask={}", m_moduleId, m_fd, readLkdPortsMask);
+    m_readLkdPortsMask = readLkdPortsMask;
     if (readLkdPortsMask)
     {
         readDeviceLkdPortsMask();
@@ -99,13 +100,10 @@ void Gen2ArchServerConnectivity::init(const bool readLkdPortsMask)
         GCFG_HCL_PORT_MAPPING_CONFIG
             .value());  // parse json port mapping file if exists. It will replace default comm configuration
 
-    m_commsRuntimeConnectivity.push_back(nullptr);
-    m_commsRuntimeConnectivity[DEFAULT_COMM_ID].reset(createRuntimeConnectivityFactory(m_moduleId,
-                                                                                       DEFAULT_COMM_ID,  // hclCommId,
-                                                                                       *this));
-    m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->init(m_serverNicsConnectivityArray,
-                                                      m_usersConnectivityConfig,
-                                                      readLkdPortsMask);
+    m_defaultRuntimeConnectivity.reset(createRuntimeConnectivityFactory(m_moduleId,
+                                                                        DEFAULT_COMM_ID,  // hclCommId,
+                                                                        *this));
+    m_defaultRuntimeConnectivity->init(m_serverNicsConnectivityArray, m_usersConnectivityConfig, readLkdPortsMask);
 }
 
 void Gen2ArchServerConnectivity::readDeviceLkdPortsMask()
@@ -117,77 +115,77 @@ void Gen2ArchServerConnectivity::readDeviceLkdPortsMask()
 
 int Gen2ArchServerConnectivity::getRemoteDevice(const uint16_t port, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getRemoteDevice(port);
+    return getRuntimeConnectivity(hclCommId).getRemoteDevice(port);
 }
 
 uint16_t Gen2ArchServerConnectivity::getPeerPort(const uint16_t port, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getPeerPort(port);
+    return getRuntimeConnectivity(hclCommId).getPeerPort(port);
 }
 
 uint16_t Gen2ArchServerConnectivity::getSubPortIndex(const uint16_t port, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getSubPortIndex(port);
+    return getRuntimeConnectivity(hclCommId).getSubPortIndex(port);
 }
 
 uint16_t Gen2ArchServerConnectivity::getScaleoutNicFromSubPort(const uint16_t subPort, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getScaleoutNicFromSubPort(subPort);
+    return getRuntimeConnectivity(hclCommId).getScaleoutNicFromSubPort(subPort);
 }
 
 bool Gen2ArchServerConnectivity::isScaleoutPort(const uint16_t port, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->isScaleoutPort(port);
+    return getRuntimeConnectivity(hclCommId).isScaleoutPort(port);
 }
 
 uint16_t Gen2ArchServerConnectivity::getMaxSubPort(const bool isScaleoutPort, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getMaxSubPort(isScaleoutPort);
+    return getRuntimeConnectivity(hclCommId).getMaxSubPort(isScaleoutPort);
 }
 
 nics_mask_t Gen2ArchServerConnectivity::getAllPorts(const int deviceId, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getAllPorts(deviceId);
+    return getRuntimeConnectivity(hclCommId).getAllPorts(deviceId);
 }
 
 nics_mask_t Gen2ArchServerConnectivity::getScaleOutPorts(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getScaleOutPorts();
+    return getRuntimeConnectivity(hclCommId).getScaleOutPorts();
 }
 
 nics_mask_t Gen2ArchServerConnectivity::getScaleUpPorts(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getScaleUpPorts();
+    return getRuntimeConnectivity(hclCommId).getScaleUpPorts();
 }
 
 uint16_t Gen2ArchServerConnectivity::getDefaultScaleUpPort(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getDefaultScaleUpPort();
+    return getRuntimeConnectivity(hclCommId).getDefaultScaleUpPort();
 }
 
 uint64_t Gen2ArchServerConnectivity::getExternalPortsMask(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getExternalPortsMask();
+    return getRuntimeConnectivity(hclCommId).getExternalPortsMask();
 }
 
 uint16_t Gen2ArchServerConnectivity::getNumScaleUpPorts(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getNumScaleUpPorts();
+    return getRuntimeConnectivity(hclCommId).getNumScaleUpPorts();
 }
 
 uint16_t Gen2ArchServerConnectivity::getNumScaleOutPorts(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getNumScaleOutPorts();
+    return getRuntimeConnectivity(hclCommId).getNumScaleOutPorts();
 }
 
 uint16_t Gen2ArchServerConnectivity::getScaleoutSubPortIndex(const uint16_t port, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getScaleoutSubPortIndex(port);
+    return getRuntimeConnectivity(hclCommId).getScaleoutSubPortIndex(port);
 }
 
 bool Gen2ArchServerConnectivity::isUpdateScaleOutGlobalContextRequired(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->isUpdateScaleOutGlobalContextRequired();
+    return getRuntimeConnectivity(hclCommId).isUpdateScaleOutGlobalContextRequired();
 }
 
 uint16_t Gen2ArchServerConnectivity::getDefaultScaleOutPortByIndex(const uint16_t nicIdx) const
@@ -197,17 +195,17 @@ uint16_t Gen2ArchServerConnectivity::getDefaultScaleOutPortByIndex(const uint16_
 
 const nics_mask_t Gen2ArchServerConnectivity::getAllScaleoutPorts(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getAllScaleoutPorts();
+    return getRuntimeConnectivity(hclCommId).getAllScaleoutPorts();
 }
 
 uint32_t Gen2ArchServerConnectivity::getBackpressureOffset(const uint16_t nic, const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getBackpressureOffset(nic);
+    return getRuntimeConnectivity(hclCommId).getBackpressureOffset(nic);
 }
 
 uint16_t Gen2ArchServerConnectivity::getMaxNumScaleUpPortsPerConnection(const HCL_Comm hclCommId) const
 {
-    return m_commsRuntimeConnectivity[DEFAULT_COMM_ID]->getMaxNumScaleUpPortsPerConnection();
+    return getRuntimeConnectivity(hclCommId).getMaxNumScaleUpPortsPerConnection();
 }
 
 void Gen2ArchServerConnectivity::setUnitTestsPortsMasks(const nics_mask_t fullScaleoutPorts,
@@ -222,3 +220,55 @@ void Gen2ArchServerConnectivity::setUnitTestsPortsMasks(const nics_mask_t fullSc
                   (uint64_t)m_lkd_enabled_scaleout_ports,
                   m_max_scaleout_ports);
 }
+
+bool Gen2ArchServerConnectivity::setUnhealthyScaleOutPorts(const nics_mask_t unhealthyPorts, const HCL_Comm hclCommId)
+{
+    VERIFY(hclCommId != DEFAULT_COMM_ID, "Unhealthy scale-out ports are set per communicator");
+
+    const unsigned chunkIndex = hclCommId / RUNTIME_CONNECTIVITY_CHUNK_SIZE;
+    if (chunkIndex >= MAX_RUNTIME_CONNECTIVITY_CHUNKS)
+    {
+        LOG_HCL_WARN(HCL,
+                     "comm({}) is beyond the {} communicators with their own scale-out ports, it uses the default ones",
+                     hclCommId,
+                     MAX_RUNTIME_CONNECTIVITY_CHUNKS * RUNTIME_CONNECTIVITY_CHUNK_SIZE);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_commsRuntimeConnectivityMutex);
+
+    RuntimeConnectivityChunk* chunk = m_commsRuntimeConnectivity[chunkIndex].load(std::memory_order_relaxed);
+    if (chunk == nullptr)
+    {
+        m_runtimeConnectivityChunks.push_back(std::make_unique<RuntimeConnectivityChunk>());
+        chunk = m_runtimeConnectivityChunks.back().get();
+        m_commsRuntimeConnectivity[chunkIndex].store(chunk, std::memory_order_release);
+    }
+    std::atomic<Gen2ArchRuntimeConnectivity*>& commConnectivity = (*chunk)[hclCommId % RUNTIME_CONNECTIVITY_CHUNK_SIZE];
+
+    // A communicator whose ports all recovered goes back to the default connectivity
+    if ((unhealthyPorts & getScaleOutPorts(DEFAULT_COMM_ID)) == 0)
+    {
+        commConnectivity.store(nullptr, std::memory_order_release);
+        return false;
+    }
+
+    Gen2ArchRuntimeConnectivityPtr connectivity(createRuntimeConnectivityFactory(m_moduleId, hclCommId, *this));
+    connectivity->init(m_serverNicsConnectivityArray, m_usersConnectivityConfig, m_readLkdPortsMask);
+    const bool rebalanced = connectivity->setUnhealthyScaleOutPorts(unhealthyPorts);
+
+    commConnectivity.store(connectivity.get(), std::memory_order_release);
+    m_commsRuntimeConnectivityOwned.push_back(std::move(connectivity));
+    return rebalanced;
+}
+
+nics_mask_t Gen2ArchServerConnectivity::getLogicalScaleOutPorts(const nics_mask_t ports, const HCL_Comm hclCommId) const
+{
+    return getRuntimeConnectivity(hclCommId).getLogicalScaleOutPorts(ports);
+}
+
+nics_mask_t Gen2ArchServerConnectivity::getPhysicalScaleOutPorts(const nics_mask_t logicalPorts,
+                                                                 const HCL_Comm    hclCommId) const
+{
+    return getRuntimeConnectivity(hclCommId).getPhysicalScaleOutPorts(logicalPorts);
+}
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <array>    // for array
+#include <atomic>   // for atomic
 #include <vector>   // for vector
 #include <cstdint>  // for uint*_t
 #include <memory>   // for unique_ptr
+#include <mutex>    // for mutex
 
 #include "platform/gen2_arch_common/server_connectivity_user_config.h"  // for ServerConnectivityUserConfig
 #include "platform/gen2_arch_common/server_connectivity_types.h"        // for ServerNicsConnectivityArray
@@ -69,6 +71,18 @@ public:
 
     void setUnitTestsPortsMasks(const nics_mask_t fullScaleoutPorts, const nics_mask_t allPortsMask);
 
+    /**
+     * @brief Give a communicator its own runtime connectivity without the unhealthy scale-out ports, before its
+     *        scale-out connections are opened or reopened. Other communicators keep their ports.
+     * @param unhealthyPorts - ports the communicator should not use, a mask without scale-out ports drops the
+     *                         communicator's own connectivity
+     * @return true if the communicator scale-out ports differ from the default ones
+     */
+    bool setUnhealthyScaleOutPorts(const nics_mask_t unhealthyPorts, const HCL_Comm hclCommId);
+    nics_mask_t getLogicalScaleOutPorts(const nics_mask_t ports, const HCL_Comm hclCommId = DEFAULT_COMM_ID) const;
+    nics_mask_t getPhysicalScaleOutPorts(const nics_mask_t logicalPorts,
+                                         const HCL_Comm    hclCommId = DEFAULT_COMM_ID) const;
+
 protected:
     virtual Gen2ArchRuntimeConnectivity*
     createRuntimeConnectivityFactory(const int                   moduleId,
@@ -82,10 +96,43 @@ protected:
     HclDeviceConfig&                   m_deviceConfig;
     struct portMaskConfig              m_lkdPortsMasks;  // Stores LKD ports mask
     bool                               m_lkdPortsMaskValid = false;
+    bool                               m_readLkdPortsMask  = true;
     uint64_t m_userScaleOutPortsMask = INVALID_PORTS_MASK;  // Stores users's external ports mask if supplied
 
-    std::vector<Gen2ArchRuntimeConnectivityPtr>
-                m_commsRuntimeConnectivity;                 // vector of dynamic runtime connectivity per comm
+    // Comm ids per chunk of the runtime connectivity table, and the chunks it can hold (comm ids are not reused)
+    static constexpr unsigned RUNTIME_CONNECTIVITY_CHUNK_SIZE = DEFAULT_COMMUNICATORS_SIZE;
+    static constexpr unsigned MAX_RUNTIME_CONNECTIVITY_CHUNKS = 1024;
+
+    using RuntimeConnectivityChunk =
+        std::array<std::atomic<Gen2ArchRuntimeConnectivity*>, RUNTIME_CONNECTIVITY_CHUNK_SIZE>;
+
+    // Runtime connectivity of a comm, comms without their own use the default one
+    Gen2ArchRuntimeConnectivity& getRuntimeConnectivity(const HCL_Comm hclCommId) const
+    {
+        const unsigned chunkIndex = hclCommId / RUNTIME_CONNECTIVITY_CHUNK_SIZE;
+        if (hclCommId != DEFAULT_COMM_ID && chunkIndex < MAX_RUNTIME_CONNECTIVITY_CHUNKS)
+        {
+            const RuntimeConnectivityChunk* chunk =
+                m_commsRuntimeConnectivity[chunkIndex].load(std::memory_order_acquire);
+            if (chunk)
+            {
+                Gen2ArchRuntimeConnectivity* connectivity =
+                    (*chunk)[hclCommId % RUNTIME_CONNECTIVITY_CHUNK_SIZE].load(std::memory_order_acquire);
+                if (connectivity) return *connectivity;
+            }
+        }
+        return *m_defaultRuntimeConnectivity;
+    }
+
+    Gen2ArchRuntimeConnectivityPtr m_defaultRuntimeConnectivity;  // DEFAULT_COMM_ID and comms with all ports healthy
+
+    // Comms' own runtime connectivity, read without a lock while another comm sets its own. The table is never
+    // reallocated and the connectivity a comm replaces is kept alive, since a reader may still hold it.
+    std::array<std::atomic<RuntimeConnectivityChunk*>, MAX_RUNTIME_CONNECTIVITY_CHUNKS> m_commsRuntimeConnectivity = {};
+    std::mutex                                             m_commsRuntimeConnectivityMutex;  // serializes writers
+    std::vector<std::unique_ptr<RuntimeConnectivityChunk>> m_runtimeConnectivityChunks;
+    std::vector<Gen2ArchRuntimeConnectivityPtr>            m_commsRuntimeConnectivityOwned;
+
     nics_mask_t m_enabled_ports_mask = INVALID_PORTS_MASK;  // After mask by LKD only, includes scaleup
     nics_mask_t m_lkd_enabled_scaleout_ports;               // After masking by LKD only
     uint16_t    m_max_scaleout_ports;                       // After masking by LKD only
@@ -0,0 +1,132 @@
+#include "platform/gen2_arch_common/all2all_schedule.h"
+
+#include <vector>  // for vector
+
+#include "hcl_test.h"
+
+// Runs the schedules of all the boxes of a collective side by side, as in a loopback run of every box
+
+static std::vector<All2AllBoxSchedule> buildAllBoxes(All2AllScheduleType type, unsigned numBoxes, uint64_t seed)
+{
+    std::vector<All2AllBoxSchedule> schedules;
+    for (unsigned box = 0; box < numBoxes; box++)
+    {
+        schedules.push_back(buildAll2AllSchedule(type, box, numBoxes, seed));
+    }
+    return schedules;
+}
+
+static bool checkSchedules(const std::vector<All2AllBoxSchedule>& schedules)
+{
+    const unsigned numBoxes = schedules.size();
+    for (unsigned box = 0; box < numBoxes; box++)
+    {
+        const All2AllBoxSchedule& schedule = schedules[box];
+        HCL_TEST_CHECK(schedule.sendBox.size() == numBoxes && schedule.recvBox.size() == numBoxes);
+        HCL_TEST_CHECK(schedule.sendBox[0] == box && schedule.recvBox[0] == box);
+
+        for (unsigned boxIter = 0; boxIter < numBoxes; boxIter++)
+        {
+            // Every box is visited exactly once in each direction, and the inverse tables agree
+            HCL_TEST_CHECK(schedule.sendIter[schedule.sendBox[boxIter]] == boxIter);
+            HCL_TEST_CHECK(schedule.recvIter[schedule.recvBox[boxIter]] == boxIter);
+
+            // The box sent to receives from this box at the same iteration
+            const unsigned peer = schedule.sendBox[boxIter];
+            HCL_TEST_CHECK(peer < numBoxes);
+            HCL_TEST_CHECK(schedules[peer].recvBox[boxIter] == box);
+        }
+    }
+
+    // At each iteration every box receives from exactly one box, so no box is an incast target
+    for (unsigned boxIter = 0; boxIter < numBoxes; boxIter++)
+    {
+        std::vector<unsigned> receivers(numBoxes, 0);
+        for (const All2AllBoxSchedule& schedule : schedules)
+        {
+            receivers[schedule.sendBox[boxIter]]++;
+        }
+        for (const unsigned count : receivers)
+        {
+            HCL_TEST_CHECK(count == 1);
+        }
+    }
+    return true;
+}
+
+static bool testShift()
+{
+    for (unsigned numBoxes = 1; numBoxes <= 33; numBoxes++)
+    {
+        const std::vector<All2AllBoxSchedule> schedules = buildAllBoxes(All2AllScheduleType::SHIFT, numBoxes, 0);
+        HCL_TEST_CHECK(checkSchedules(schedules));
+
+        // The shifted order of the collective routines
+        for (unsigned box = 0; box < numBoxes; box++)
+        {
+            for (unsigned boxIter = 0; boxIter < numBoxes; boxIter++)
+            {
+                HCL_TEST_CHECK(schedules[box].sendBox[boxIter] == (box + boxIter) % numBoxes);
+                HCL_TEST_CHECK(schedules[box].recvBox[boxIter] == (box + numBoxes - boxIter) % numBoxes);
+            }
+        }
+    }
+    return true;
+}
+
+static bool testXor()
+{
+    for (unsigned numBoxes = 1; numBoxes <= 64; numBoxes *= 2)
+    {
+        const std::vector<All2AllBoxSchedule> schedules = buildAllBoxes(All2AllScheduleType::XOR, numBoxes, 0);
+        HCL_TEST_CHECK(checkSchedules(schedules));
+
+        // Pairwise exchange, the box sent to is the box received from
+        for (const All2AllBoxSchedule& schedule : schedules)
+        {
+            HCL_TEST_CHECK(schedule.sendBox == schedule.recvBox);
+        }
+    }
+    return true;
+}
+
+static bool testRandom()
+{
+    for (unsigned numBoxes = 1; numBoxes <= 33; numBoxes++)
+    {
+        for (uint64_t seed = 0; seed < 16; seed++)
+        {
+            HCL_TEST_CHECK(checkSchedules(buildAllBoxes(All2AllScheduleType::RANDOM, numBoxes, seed)));
+        }
+    }
+
+    // The seed, i.e. the collective, changes the step order
+    const All2AllBoxSchedule first = buildAll2AllSchedule(All2AllScheduleType::RANDOM, 0, 16, 0);
+    bool                     differ = false;
+    for (uint64_t seed = 1; seed < 16; seed++)
+    {
+        differ |= buildAll2AllSchedule(All2AllScheduleType::RANDOM, 0, 16, seed).sendBox != first.sendBox;
+    }
+    HCL_TEST_CHECK(differ);
+    return true;
+}
+
+static bool testXorNotPowerOf2()
+{
+    // The caller falls back to the shifted order, here peers out of range are dropped and boxes 2 and 3 never visited
+    const All2AllBoxSchedule schedule = buildAll2AllSchedule(All2AllScheduleType::XOR, 5, 6, 0);
+    HCL_TEST_CHECK(schedule.sendIter[2] == 6 && schedule.sendIter[3] == 6);
+    return true;
+}
+
+int main()
+{
+    unsigned failures = 0;
+
+    HCL_TEST_RUN(testShift, failures);
+    HCL_TEST_RUN(testXor, failures);
+    HCL_TEST_RUN(testRandom, failures);
+    HCL_TEST_RUN(testXorNotPowerOf2, failures);
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdio>  // for fprintf
+
+// Fails the calling test function, which returns bool
+#define HCL_TEST_CHECK(cond)                                                                                           \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(cond))                                                                                                   \
+        {                                                                                                              \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);                              \
+            return false;                                                                                              \
+        }                                                                                                              \
+    } while (0)
+
+// Runs a test function from main(), counting the failures
+#define HCL_TEST_RUN(test, failures)                                                                                   \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        const bool passed = test();                                                                                    \
+        std::fprintf(stderr, "%s: %s\n", #test, passed ? "passed" : "FAILED");                                         \
+        if (!passed) (failures)++;                                                                                     \
+    } while (0)
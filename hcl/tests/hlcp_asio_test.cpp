@@ -0,0 +1,221 @@
+#include "hlcp/asio.h"
+
+#include <arpa/inet.h>   // for htonl
+#include <fcntl.h>       // for fcntl, O_NONBLOCK
+#include <netinet/in.h>  // for sockaddr_in
+#include <sys/socket.h>  // for socket, accept, connect
+#include <unistd.h>      // for read, write, close
+
+#include <atomic>  // for atomic
+#include <chrono>  // for steady_clock
+#include <memory>  // for unique_ptr
+#include <thread>  // for sleep_for
+#include <vector>  // for vector
+
+#include "hcl_test.h"
+
+// asio_t over loopback TCP, with the epoll backend and with io_uring. io_uring falls back to epoll when the kernel
+// does not provide it, so the second run then repeats the first.
+
+static constexpr unsigned CONNECTIONS  = 32;
+static constexpr unsigned IO_THREADS   = 3;
+static constexpr unsigned MESSAGES     = 256;
+static constexpr size_t   MESSAGE_SIZE = 1000;
+
+/**
+ * Reads everything arriving on a socket, re-arming until the expected bytes arrived
+ */
+class reader_t : public asio_client_t
+{
+public:
+    reader_t(int fd, size_t expected) : fd_(fd), expected_(expected) {}
+    ~reader_t() { close(fd_); }
+
+    virtual int      io_fd() const override { return fd_; }
+    virtual uint32_t events() const override { return EPOLLIN | EPOLLONESHOT; }
+
+    virtual int io_event(uint32_t events) override
+    {
+        events_++;
+
+        char buffer[4096];
+        while (true)
+        {
+            const ssize_t size = read(fd_, buffer, sizeof(buffer));
+            if (size <= 0) break;
+            received_ += size;
+        }
+
+        return received_ < expected_ ? IO_REARM : IO_NONE;
+    }
+
+    size_t   received() const { return received_; }
+    unsigned eventCount() const { return events_; }
+
+private:
+    const int             fd_;
+    const size_t          expected_;
+    std::atomic<size_t>   received_ {0};
+    std::atomic<unsigned> events_ {0};
+};
+
+struct loopback_t
+{
+    std::vector<int> writers;
+    std::vector<int> readers;
+};
+
+static bool connectLoopback(loopback_t& loopback, unsigned connections)
+{
+    const int listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener == -1) return false;
+
+    sockaddr_in addr     = {};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;
+    socklen_t addrLen    = sizeof(addr);
+    if (bind(listener, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(listener, connections) != 0 ||
+        getsockname(listener, (sockaddr*)&addr, &addrLen) != 0)
+    {
+        close(listener);
+        return false;
+    }
+
+    for (unsigned i = 0; i < connections; i++)
+    {
+        const int writer = socket(AF_INET, SOCK_STREAM, 0);
+        if (writer == -1 || connect(writer, (sockaddr*)&addr, sizeof(addr)) != 0) break;
+
+        const int reader = accept(listener, nullptr, nullptr);
+        if (reader == -1) break;
+        fcntl(reader, F_SETFL, fcntl(reader, F_GETFL) | O_NONBLOCK);
+
+        loopback.writers.push_back(writer);
+        loopback.readers.push_back(reader);
+    }
+
+    close(listener);
+    return loopback.readers.size() == connections;
+}
+
+template<typename Cond>
+static bool waitFor(Cond cond)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!cond())
+    {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+static bool testTraffic(bool io_uring)
+{
+    loopback_t loopback;
+    HCL_TEST_CHECK(connectLoopback(loopback, CONNECTIONS));
+
+    asio_t asio;
+    HCL_TEST_CHECK(asio.start(IO_THREADS, io_uring));
+
+    std::vector<std::unique_ptr<reader_t>> readers;
+    for (const int fd : loopback.readers)
+    {
+        readers.push_back(std::make_unique<reader_t>(fd, MESSAGES * MESSAGE_SIZE));
+        HCL_TEST_CHECK(asio.arm_monitor(*readers.back()));
+    }
+
+    // Messages are interleaved over the connections, so several of them are ready together
+    const std::vector<char> message(MESSAGE_SIZE, 'x');
+    for (unsigned m = 0; m < MESSAGES; m++)
+    {
+        for (const int fd : loopback.writers)
+        {
+            HCL_TEST_CHECK(write(fd, message.data(), message.size()) == (ssize_t)message.size());
+        }
+    }
+
+    for (const std::unique_ptr<reader_t>& reader : readers)
+    {
+        HCL_TEST_CHECK(waitFor([&]() { return reader->received() == MESSAGES * MESSAGE_SIZE; }));
+        HCL_TEST_CHECK(reader->eventCount() > 0);
+    }
+
+    for (const std::unique_ptr<reader_t>& reader : readers)
+    {
+        asio.remove(*reader);
+    }
+    HCL_TEST_CHECK(asio.stop());
+
+    for (const int fd : loopback.writers)
+    {
+        close(fd);
+    }
+    return true;
+}
+
+static bool testRemoveArmed(bool io_uring)
+{
+    // A client removed while armed gets no event for data arriving later
+    loopback_t loopback;
+    HCL_TEST_CHECK(connectLoopback(loopback, 2));
+
+    asio_t asio;
+    HCL_TEST_CHECK(asio.start(IO_THREADS, io_uring));
+
+    reader_t removed(loopback.readers[0], MESSAGE_SIZE);
+    reader_t kept(loopback.readers[1], MESSAGE_SIZE);
+    HCL_TEST_CHECK(asio.arm_monitor(removed));
+    HCL_TEST_CHECK(asio.arm_monitor(kept));
+    HCL_TEST_CHECK(asio.remove(removed));
+
+    const std::vector<char> message(MESSAGE_SIZE, 'x');
+    HCL_TEST_CHECK(write(loopback.writers[0], message.data(), message.size()) == (ssize_t)message.size());
+    HCL_TEST_CHECK(write(loopback.writers[1], message.data(), message.size()) == (ssize_t)message.size());
+
+    // The kept client's event shows the loop went past the removed one's data
+    HCL_TEST_CHECK(waitFor([&]() { return kept.received() == MESSAGE_SIZE; }));
+    HCL_TEST_CHECK(removed.eventCount() == 0);
+
+    asio.remove(kept);
+    HCL_TEST_CHECK(asio.stop());
+
+    for (const int fd : loopback.writers)
+    {
+        close(fd);
+    }
+    return true;
+}
+
+static bool testEpollTraffic()
+{
+    return testTraffic(false);
+}
+
+static bool testUringTraffic()
+{
+    return testTraffic(true);
+}
+
+static bool testEpollRemoveArmed()
+{
+    return testRemoveArmed(false);
+}
+
+static bool testUringRemoveArmed()
+{
+    return testRemoveArmed(true);
+}
+
+int main()
+{
+    unsigned failures = 0;
+
+    HCL_TEST_RUN(testEpollTraffic, failures);
+    HCL_TEST_RUN(testUringTraffic, failures);
+    HCL_TEST_RUN(testEpollRemoveArmed, failures);
+    HCL_TEST_RUN(testUringRemoveArmed, failures);
+
+    return failures == 0 ? 0 : 1;
+}
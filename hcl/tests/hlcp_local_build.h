@@ -0,0 +1,28 @@
+#pragma once
+
+// HLCP sources built with LOCAL_BUILD take their logging and checks from the includer, this header provides them for
+// the tests. Force included, before the sources' own headers.
+
+#include <cstdio>   // for fprintf
+#include <cstdlib>  // for abort
+
+#include "hcl_bits.h"  // for bits_t
+
+#define HLCP_LOG(...)
+#define HLCP_DBG(...)
+#define HLCP_INF(...)
+#define HLCP_ERR(fmt, ...) std::fprintf(stderr, "HLCP error: %s\n", fmt)
+#define HLCP_CRT(fmt, ...) std::fprintf(stderr, "HLCP critical: %s\n", fmt)
+#define HLCP_WRN(fmt, ...) std::fprintf(stderr, "HLCP warning: %s\n", fmt)
+
+#define FOR_I(N) for (unsigned i = 0; i < (N); i++)
+
+#define VERIFY(cond, ...)                                                                                              \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(cond))                                                                                                   \
+        {                                                                                                              \
+            std::fprintf(stderr, "%s:%d: VERIFY failed: %s\n", __FILE__, __LINE__, #cond);                             \
+            std::abort();                                                                                              \
+        }                                                                                                              \
+    } while (0)
@@ -0,0 +1,186 @@
+#include "infra/hcl_node_cache.h"
+
+#include <dirent.h>  // for opendir, readdir
+#include <fstream>   // for ifstream, ofstream
+#include <hwloc.h>   // for hwloc_topology_export_xmlbuffer
+#include <iterator>  // for istreambuf_iterator
+#include <string>    // for string
+#include <unistd.h>  // for rmdir
+
+#include "hcl_global_conf.h"     // for GCFG_HCL_NODE_CACHE_DIR
+#include "hcl_utils.h"           // for hcclResult_t
+#include "infra/hcl_topology.h"  // for HwlocTopology
+#include "hcl_test.h"
+
+// The node cache in a temporary directory, with hwloc topologies built from synthetic descriptions as the entries
+
+// VERIFY reports failures through these, which the library and Synapse provide
+volatile hcclResult_t g_status = hcclSuccess;
+uint64_t              hclNotifyFailureV2(DfaErrorCode dfaErrorCode, uint64_t options, std::string msg)
+{
+    return 0;
+}
+
+static std::string s_cacheDir;
+
+static std::string entryPath(const std::string& name)
+{
+    return s_cacheDir + "/hcl_" + name + ".cache";
+}
+
+static std::string readFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+static unsigned countFiles(const std::string& dirPath)
+{
+    unsigned files = 0;
+    DIR*     dir   = opendir(dirPath.c_str());
+    if (dir == nullptr) return 0;
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        if (entry->d_name[0] != '.') files++;
+    }
+    closedir(dir);
+    return files;
+}
+
+static void removeDir(const std::string& dirPath)
+{
+    DIR* dir = opendir(dirPath.c_str());
+    if (dir == nullptr) return;
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        if (entry->d_name[0] != '.') std::remove((dirPath + "/" + entry->d_name).c_str());
+    }
+    closedir(dir);
+    rmdir(dirPath.c_str());
+}
+
+// XML export of a topology built from an hwloc synthetic description, e.g. "pack:2 core:4 pu:1"
+static std::string syntheticTopologyXml(const char* description)
+{
+    hwloc_topology_t topology = NULL;
+    std::string      xml;
+    if (hwloc_topology_init(&topology) != 0) return xml;
+
+    char* buffer = NULL;
+    int   length = 0;
+    if (hwloc_topology_set_synthetic(topology, description) == 0 && hwloc_topology_load(topology) == 0 &&
+        hwloc_topology_export_xmlbuffer(topology, &buffer, &length, 0) == 0)
+    {
+        xml.assign(buffer, length > 0 ? length - 1 : 0);
+        hwloc_free_xmlbuffer(topology, buffer);
+    }
+
+    hwloc_topology_destroy(topology);
+    return xml;
+}
+
+static bool testDisabled()
+{
+    GCFG_HCL_NODE_CACHE_DIR.setValue(std::string(""));
+    hcl::node_cache::store("disabled", "value");
+    HCL_TEST_CHECK(!hcl::node_cache::load("disabled").has_value());
+
+    GCFG_HCL_NODE_CACHE_DIR.setValue(s_cacheDir);
+    HCL_TEST_CHECK(!hcl::node_cache::load("disabled").has_value());
+    HCL_TEST_CHECK(countFiles(s_cacheDir) == 0);
+    return true;
+}
+
+static bool testMissAndHit()
+{
+    const std::string xml = syntheticTopologyXml("pack:2 core:4 pu:2");
+    HCL_TEST_CHECK(!xml.empty());
+
+    HCL_TEST_CHECK(!hcl::node_cache::load("topology").has_value());
+
+    hcl::node_cache::store("topology", xml);
+    HCL_TEST_CHECK(hcl::node_cache::load("topology") == xml);
+
+    // The entry is the fingerprint line and the value, the temporary file is renamed away
+    HCL_TEST_CHECK(readFile(entryPath("topology")) == hcl::node_cache::fingerprint() + "\n" + xml);
+    HCL_TEST_CHECK(countFiles(s_cacheDir) == 1);
+
+    // A store replaces the previous value
+    const std::string otherXml = syntheticTopologyXml("pack:1 core:2 pu:1");
+    hcl::node_cache::store("topology", otherXml);
+    HCL_TEST_CHECK(hcl::node_cache::load("topology") == otherXml);
+    HCL_TEST_CHECK(countFiles(s_cacheDir) == 1);
+    return true;
+}
+
+static bool testStaleEntry()
+{
+    // An entry of another boot or PCI device list, as left by the node before a reboot or a device change
+    const std::string xml = syntheticTopologyXml("pack:2 core:4 pu:2");
+    {
+        std::ofstream file(entryPath("stale"), std::ios::binary | std::ios::trunc);
+        file << "v1 boot 00000000-0000-0000-0000-000000000000 pci 0000000000000000\n" << xml;
+    }
+    HCL_TEST_CHECK(!hcl::node_cache::load("stale").has_value());
+
+    // The caller recomputes and stores it again, under the current fingerprint
+    hcl::node_cache::store("stale", xml);
+    HCL_TEST_CHECK(hcl::node_cache::load("stale") == xml);
+
+    // Truncated entry, without the fingerprint line end
+    {
+        std::ofstream file(entryPath("stale"), std::ios::binary | std::ios::trunc);
+        file << hcl::node_cache::fingerprint().substr(0, 8);
+    }
+    HCL_TEST_CHECK(!hcl::node_cache::load("stale").has_value());
+    return true;
+}
+
+static bool testTopologyFromCache()
+{
+    // A cached topology is imported instead of discovered, so its synthetic layout shows through. Only the first
+    // topology of the process reads the cache, later ones import it from memory.
+    const std::string entry = fmt::format("hwloc_topology_{:x}", hwloc_get_api_version());
+    hcl::node_cache::store(entry, syntheticTopologyXml("pack:3 core:5 pu:1"));
+
+    for (unsigned build = 0; build < 2; build++)
+    {
+        HwlocTopology topology;
+        HCL_TEST_CHECK(hwloc_get_nbobjs_by_type(*topology, HWLOC_OBJ_PACKAGE) == 3);
+        HCL_TEST_CHECK(hwloc_get_nbobjs_by_type(*topology, HWLOC_OBJ_CORE) == 15);
+    }
+    return true;
+}
+
+int main()
+{
+    char dirTemplate[] = "/tmp/hcl_node_cache_test.XXXXXX";
+    if (mkdtemp(dirTemplate) == nullptr)
+    {
+        std::fprintf(stderr, "Failed to create a temporary directory\n");
+        return 1;
+    }
+    s_cacheDir = dirTemplate;
+
+    // Without a boot id the cache stays disabled, so there is nothing to test
+    if (hcl::node_cache::fingerprint().empty())
+    {
+        std::fprintf(stderr, "No boot id, skipping\n");
+        removeDir(s_cacheDir);
+        return 0;
+    }
+
+    unsigned failures = 0;
+
+    HCL_TEST_RUN(testDisabled, failures);
+    HCL_TEST_RUN(testMissAndHit, failures);
+    HCL_TEST_RUN(testStaleEntry, failures);
+    HCL_TEST_RUN(testTopologyFromCache, failures);
+
+    removeDir(s_cacheDir);
+    return failures == 0 ? 0 : 1;
+}
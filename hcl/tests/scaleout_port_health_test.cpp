@@ -0,0 +1,180 @@
+#include "platform/gen2_arch_common/scaleout_port_health.h"
+
+#include "hcl_test.h"
+
+static constexpr uint64_t ERROR_THRESHOLD = 16;
+
+// Scale-out ports of the device, laid out as on HLS2
+static const nics_mask_t SCALE_OUT_PORTS((1ULL << 8) | (1ULL << 22) | (1ULL << 23));
+static constexpr uint16_t MAX_SUB_PORTS = 3;
+
+static ScaleOutPortAssignment rebalance(const nics_mask_t configuredPorts, const ScaleOutPortHealth& health)
+{
+    return assignScaleOutPorts(SCALE_OUT_PORTS,
+                               selectHealthyScaleOutPorts(configuredPorts, health.getUnhealthyPorts()),
+                               MAX_SUB_PORTS);
+}
+
+static bool testPortDownAndUp()
+{
+    ScaleOutPortHealth health(ERROR_THRESHOLD);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == 0);
+
+    health.onPortDown(8);
+    health.onPortDown(22);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == ((1ULL << 8) | (1ULL << 22)));
+
+    health.onPortUp(8);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == (1ULL << 22));
+
+    // Out of range ports are ignored
+    health.onPortDown(MAX_NICS_GEN2ARCH);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == (1ULL << 22));
+    return true;
+}
+
+static bool testFirstSampleIsBaseline()
+{
+    // Errors counted before the first sample, e.g. since driver load, do not degrade the port
+    ScaleOutPortHealth health(ERROR_THRESHOLD);
+    health.onErrorCount(8, 1000);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == 0);
+
+    health.onErrorCount(8, 1000 + ERROR_THRESHOLD - 1);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == 0);
+
+    health.onErrorCount(8, 1000 + 2 * ERROR_THRESHOLD);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == (1ULL << 8));
+    return true;
+}
+
+static bool testRecovery()
+{
+    ScaleOutPortHealth health(ERROR_THRESHOLD);
+    health.onErrorCount(8, 0);
+    health.onErrorCount(8, ERROR_THRESHOLD);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == (1ULL << 8));
+
+    // A sample with a few new errors restarts the clean samples count
+    health.onErrorCount(8, ERROR_THRESHOLD);
+    health.onErrorCount(8, ERROR_THRESHOLD + 1);
+    for (unsigned sample = 0; sample < ScaleOutPortHealth::CLEAN_SAMPLES_TO_RECOVER - 1; sample++)
+    {
+        health.onErrorCount(8, ERROR_THRESHOLD + 1);
+        HCL_TEST_CHECK(health.getUnhealthyPorts() == (1ULL << 8));
+    }
+
+    health.onErrorCount(8, ERROR_THRESHOLD + 1);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == 0);
+    return true;
+}
+
+static bool testCounterReset()
+{
+    // Counters reset by a driver reload are a new baseline, not a huge error count
+    ScaleOutPortHealth health(ERROR_THRESHOLD);
+    health.onErrorCount(8, 1000);
+    health.onErrorCount(8, 3);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == 0);
+
+    health.onErrorCount(8, 3 + ERROR_THRESHOLD);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == (1ULL << 8));
+    return true;
+}
+
+static bool testDownAndDegraded()
+{
+    // A degraded port stays unhealthy when its link comes back up
+    ScaleOutPortHealth health(ERROR_THRESHOLD);
+    health.onErrorCount(9, 0);
+    health.onPortDown(9);
+    health.onErrorCount(9, ERROR_THRESHOLD);
+    health.onPortUp(9);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == (1ULL << 9));
+    return true;
+}
+
+static bool testThresholdDisabled()
+{
+    ScaleOutPortHealth health(0);
+    health.onErrorCount(8, 0);
+    health.onErrorCount(8, 1000000);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == 0);
+
+    health.onPortDown(8);
+    HCL_TEST_CHECK(health.getUnhealthyPorts() == (1ULL << 8));
+    return true;
+}
+
+static bool testRebalanceAroundDownPort()
+{
+    ScaleOutPortHealth health(ERROR_THRESHOLD);
+
+    ScaleOutPortAssignment assignment = rebalance(SCALE_OUT_PORTS, health);
+    HCL_TEST_CHECK(assignment.enabledPorts == SCALE_OUT_PORTS);
+    HCL_TEST_CHECK(assignment.subPorts.at(8) == 0);
+    HCL_TEST_CHECK(assignment.subPorts.at(22) == 1);
+    HCL_TEST_CHECK(assignment.subPorts.at(23) == 2);
+
+    // The remaining ports take the lowest sub port indices, so they carry the traffic of the down one
+    health.onPortDown(22);
+    assignment = rebalance(SCALE_OUT_PORTS, health);
+    HCL_TEST_CHECK(assignment.enabledPorts == ((1ULL << 8) | (1ULL << 23)));
+    HCL_TEST_CHECK(assignment.subPorts.at(8) == 0);
+    HCL_TEST_CHECK(assignment.subPorts.at(23) == 1);
+    HCL_TEST_CHECK(assignment.subPorts.at(22) == 2);
+
+    // And give it back when it is up again
+    health.onPortUp(22);
+    assignment = rebalance(SCALE_OUT_PORTS, health);
+    HCL_TEST_CHECK(assignment.enabledPorts == SCALE_OUT_PORTS);
+    HCL_TEST_CHECK(assignment.subPorts.at(22) == 1);
+    return true;
+}
+
+static bool testRebalanceDegradedPort()
+{
+    // Ports masked by the user stay out, a degraded port leaves a single one
+    const nics_mask_t  configuredPorts((1ULL << 22) | (1ULL << 23));
+    ScaleOutPortHealth health(ERROR_THRESHOLD);
+    health.onErrorCount(23, 0);
+    health.onErrorCount(23, ERROR_THRESHOLD);
+
+    const ScaleOutPortAssignment assignment = rebalance(configuredPorts, health);
+    HCL_TEST_CHECK(assignment.enabledPorts == (1ULL << 22));
+    HCL_TEST_CHECK(assignment.subPorts.at(22) == 0);
+    HCL_TEST_CHECK(assignment.subPorts.at(8) == 2);
+    HCL_TEST_CHECK(assignment.subPorts.at(23) == 1);
+    return true;
+}
+
+static bool testRebalanceAllPortsDown()
+{
+    // Without any healthy port the configured ones are all kept
+    ScaleOutPortHealth health(ERROR_THRESHOLD);
+    for (auto port : SCALE_OUT_PORTS)
+    {
+        health.onPortDown(port);
+    }
+
+    HCL_TEST_CHECK(rebalance(SCALE_OUT_PORTS, health).enabledPorts == SCALE_OUT_PORTS);
+    HCL_TEST_CHECK(selectHealthyScaleOutPorts(0, health.getUnhealthyPorts()) == 0);
+    return true;
+}
+
+int main()
+{
+    unsigned failures = 0;
+
+    HCL_TEST_RUN(testPortDownAndUp, failures);
+    HCL_TEST_RUN(testFirstSampleIsBaseline, failures);
+    HCL_TEST_RUN(testRecovery, failures);
+    HCL_TEST_RUN(testCounterReset, failures);
+    HCL_TEST_RUN(testDownAndDegraded, failures);
+    HCL_TEST_RUN(testThresholdDisabled, failures);
+    HCL_TEST_RUN(testRebalanceAroundDownPort, failures);
+    HCL_TEST_RUN(testRebalanceDegradedPort, failures);
+    HCL_TEST_RUN(testRebalanceAllPortsDown, failures);
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+#include "infra/hcl_spsc_fifo.h"
+
+#include <chrono>   // for steady_clock
+#include <cstdio>   // for printf
+#include <cstdlib>  // for atoll
+#include <memory>   // for make_unique
+#include <string>   // for string
+#include <thread>   // for thread
+
+// Micro-benchmark of the host stream FIFO: a producer thread writes fixed size commands, a consumer thread reads and
+// frees them one at a time as the host scheduler does. It compares the FIFO with the previous implementation, which
+// kept both indices on one cache line and re-read the other side's index on every access, and publishes per command
+// and per batch. Every command carries its sequence number, which the consumer checks.
+//
+// Usage: spsc_fifo_bench [commands]
+
+// VERIFY reports failures through these, which the library and Synapse provide
+volatile hcclResult_t g_status = hcclSuccess;
+uint64_t              hclNotifyFailureV2(DfaErrorCode dfaErrorCode, uint64_t options, std::string msg)
+{
+    return 0;
+}
+
+// Dwords of a host scheduler scale-out command
+static constexpr uint64_t COMMAND_DWORDS = 16;
+static constexpr uint64_t CAPACITY       = 1024 * 1024;
+static constexpr unsigned BATCH_SIZE     = 8;
+
+/**
+ * The FIFO as it was before producer and consumer state were split, kept as the benchmark baseline
+ */
+template<uint64_t CAP>
+class LegacySpscFifo
+{
+    static constexpr uint64_t MASK = CAP - 1;
+
+public:
+    uint64_t getCi() const { return m_ci & MASK; }
+    uint64_t getPi() const { return m_pi & MASK; }
+    uint64_t getNextPi() const { return m_next_pi & MASK; }
+    uint64_t getWatermark() const { return m_watermark & MASK; }
+    bool     isEmpty() const { return m_ci >= m_pi; }
+    bool     isFull() const { return getCi() == getPi() && !isEmpty(); }
+
+    uint32_t* getNextPtr(uint64_t sizeInDwords)
+    {
+        while (isFull())
+        {
+        }
+
+        uint32_t* ret = &m_buf[getPi()];
+        if (getPi() >= getCi() && sizeInDwords > (CAP - getPi()))
+        {
+            m_watermark = m_pi;
+            m_next_pi += (CAP - getPi());
+            ret = &m_buf[getNextPi()];
+
+            while (m_next_pi + sizeInDwords - m_ci >= CAP)
+            {
+            }
+        }
+
+        if (getPi() < getCi())
+        {
+            if (getCi() - getPi() <= sizeInDwords)
+            {
+                while (!isEmpty())
+                {
+                }
+            }
+
+            if (sizeInDwords > CAP - getPi())
+            {
+                m_watermark = m_pi;
+                m_next_pi += (CAP - getPi());
+                ret = &m_buf[getNextPi()];
+            }
+        }
+
+        m_next_pi += sizeInDwords;
+        return ret;
+    }
+
+    void submit() { m_pi = m_next_pi; }
+
+    uint32_t* read(uint64_t* sizeInDwords)
+    {
+        uint32_t* ret = &m_buf[getCi()];
+        if (isEmpty())
+        {
+            *sizeInDwords = 0;
+            return ret;
+        }
+
+        if (m_ci <= m_watermark && m_watermark <= m_pi && m_watermark > 0)
+        {
+            if (m_ci == m_watermark && m_watermark < m_pi)
+            {
+                m_ci += CAP - getCi();
+                *sizeInDwords = m_pi - m_ci;
+                ret           = &m_buf[getCi()];
+            }
+            else
+            {
+                *sizeInDwords = getWatermark() - getCi();
+            }
+        }
+        else
+        {
+            *sizeInDwords = m_pi - m_ci;
+            if (*sizeInDwords > (CAP - getCi()))
+            {
+                *sizeInDwords = CAP - getCi();
+            }
+        }
+
+        return ret;
+    }
+
+    void free(uint64_t sizeInDwords)
+    {
+        m_ci += sizeInDwords;
+        if (m_ci == m_watermark && m_watermark > 0)
+        {
+            m_ci += (CAP - getCi());
+        }
+    }
+
+private:
+    std::array<uint32_t, CAP> m_buf;
+
+    volatile uint64_t m_ci        = 0;
+    volatile uint64_t m_pi        = 0;
+    volatile uint64_t m_next_pi   = 0;
+    volatile uint64_t m_watermark = 0;
+};
+
+template<typename Fifo>
+static void produce(Fifo& fifo, uint64_t commands, unsigned batchSize)
+{
+    for (uint64_t seq = 0; seq < commands; seq++)
+    {
+        if constexpr (!std::is_same_v<Fifo, LegacySpscFifo<CAPACITY>>)
+        {
+            if (batchSize > 1 && seq % batchSize == 0) fifo.beginBatch();
+        }
+
+        uint32_t* command = fifo.getNextPtr(COMMAND_DWORDS);
+        command[0]        = (uint32_t)seq;
+        command[1]        = (uint32_t)(seq >> 32);
+        fifo.submit();
+
+        if constexpr (!std::is_same_v<Fifo, LegacySpscFifo<CAPACITY>>)
+        {
+            if (batchSize > 1 && (seq % batchSize == batchSize - 1 || seq == commands - 1)) fifo.endBatch();
+        }
+    }
+}
+
+template<typename Fifo>
+static bool consume(Fifo& fifo, uint64_t commands)
+{
+    for (uint64_t seq = 0; seq < commands;)
+    {
+        uint64_t        size    = 0;
+        const uint32_t* command = fifo.read(&size);
+        if (size == 0) continue;
+
+        if (size < COMMAND_DWORDS || (command[0] | ((uint64_t)command[1] << 32)) != seq)
+        {
+            std::fprintf(stderr, "command %lu: read %lu dwords, sequence %u\n", seq, size, command[0]);
+            return false;
+        }
+        fifo.free(COMMAND_DWORDS);
+        seq++;
+    }
+    return true;
+}
+
+template<typename Fifo>
+static bool run(const char* name, uint64_t commands, unsigned batchSize)
+{
+    std::unique_ptr<Fifo> fifo = std::make_unique<Fifo>();
+    bool                  ok   = false;
+
+    const auto  start    = std::chrono::steady_clock::now();
+    std::thread consumer = std::thread([&]() { ok = consume(*fifo, commands); });
+    produce(*fifo, commands, batchSize);
+    consumer.join();
+    const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%-24s %10lu commands %8.2f Mcommands/s\n", name, commands, commands / sec / 1e6);
+    return ok;
+}
+
+int main(int argc, char* argv[])
+{
+    const uint64_t commands = argc > 1 ? std::atoll(argv[1]) : 4 * 1024 * 1024;
+    unsigned       failures = 0;
+
+    if (!run<LegacySpscFifo<CAPACITY>>("previous FIFO", commands, 1)) failures++;
+    if (!run<spsc_fifo_t<CAPACITY>>("FIFO", commands, 1)) failures++;
+    if (!run<spsc_fifo_t<CAPACITY>>("FIFO, batches of 8", commands, BATCH_SIZE)) failures++;
+
+    return failures == 0 ? 0 : 1;
+}
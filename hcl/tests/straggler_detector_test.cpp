@@ -0,0 +1,147 @@
+#include "hccl/straggler_detector.h"
+
+#include <vector>  // for vector
+
+#include "hcl_test.h"
+
+static std::vector<LatencyReportMessage> makeReports(unsigned commSize, uint32_t waitUsec)
+{
+    std::vector<LatencyReportMessage> reports(commSize);
+    for (HCL_Rank rank = 0; rank < commSize; rank++)
+    {
+        reports[rank]           = {};
+        reports[rank].rank      = rank;
+        reports[rank].submitted = LATENCY_REPORT_COLLECTIVES;
+        for (uint32_t& wait : reports[rank].waitUsec)
+        {
+            wait = waitUsec;
+        }
+    }
+    return reports;
+}
+
+static bool testNoStragglers()
+{
+    const std::vector<LatencyReportMessage> reports = makeReports(8, 1000);
+
+    HCL_TEST_CHECK(StragglerDetector::findStragglers(reports, 2.0).empty());
+    return true;
+}
+
+static bool testLateRank()
+{
+    // Rank 3 calls every collective last, so it does not wait for the others on the device
+    std::vector<LatencyReportMessage> reports = makeReports(8, 1000);
+    for (uint32_t& wait : reports[3].waitUsec)
+    {
+        wait = 0;
+    }
+
+    const std::vector<RankLateness> stragglers = StragglerDetector::findStragglers(reports, 2.0);
+    HCL_TEST_CHECK(stragglers.size() == 1);
+    HCL_TEST_CHECK(stragglers[0].rank == 3);
+    HCL_TEST_CHECK(stragglers[0].lateCollectives == LATENCY_REPORT_COLLECTIVES);
+    HCL_TEST_CHECK(stragglers[0].collectives == LATENCY_REPORT_COLLECTIVES);
+    HCL_TEST_CHECK(stragglers[0].meanLateUsec == 1000);
+    HCL_TEST_CHECK(stragglers[0].maxLateUsec == 1000);
+    return true;
+}
+
+static bool testMostOftenLateFirst()
+{
+    std::vector<LatencyReportMessage> reports = makeReports(8, 1000);
+    for (unsigned collective = 0; collective < LATENCY_REPORT_COLLECTIVES; collective++)
+    {
+        reports[5].waitUsec[collective] = 0;
+        if (collective % 2 == 0) reports[1].waitUsec[collective] = 0;
+    }
+
+    const std::vector<RankLateness> stragglers = StragglerDetector::findStragglers(reports, 2.0);
+    HCL_TEST_CHECK(stragglers.size() == 2);
+    HCL_TEST_CHECK(stragglers[0].rank == 5);
+    HCL_TEST_CHECK(stragglers[1].rank == 1);
+    HCL_TEST_CHECK(stragglers[1].lateCollectives == LATENCY_REPORT_COLLECTIVES / 2);
+    return true;
+}
+
+static bool testThresholds()
+{
+    // Late by less than the minimal lateness
+    std::vector<LatencyReportMessage> reports = makeReports(4, StragglerDetector::MIN_LATENESS_USEC - 10);
+    for (uint32_t& wait : reports[0].waitUsec)
+    {
+        wait = 0;
+    }
+    HCL_TEST_CHECK(StragglerDetector::findStragglers(reports, 2.0).empty());
+
+    // Late by 400us, which is below the factor but above a lower one
+    reports = makeReports(4, 1000);
+    for (uint32_t& wait : reports[0].waitUsec)
+    {
+        wait = 600;
+    }
+    HCL_TEST_CHECK(StragglerDetector::findStragglers(reports, 2.0).empty());
+    HCL_TEST_CHECK(StragglerDetector::findStragglers(reports, 1.5).size() == 1);
+
+    // Late on less than a quarter of the collectives
+    reports = makeReports(4, 1000);
+    for (unsigned collective = 0; collective < LATENCY_REPORT_COLLECTIVES / 4 - 1; collective++)
+    {
+        reports[2].waitUsec[collective] = 0;
+    }
+    HCL_TEST_CHECK(StragglerDetector::findStragglers(reports, 2.0).empty());
+    return true;
+}
+
+static bool testMissingSamples()
+{
+    // Collectives a rank has no sample of are compared among the other ranks only
+    std::vector<LatencyReportMessage> reports = makeReports(4, 1000);
+    for (unsigned collective = 0; collective < LATENCY_REPORT_COLLECTIVES; collective++)
+    {
+        reports[0].waitUsec[collective] = LATENCY_REPORT_NO_SAMPLE;
+        reports[1].waitUsec[collective] = collective < LATENCY_REPORT_COLLECTIVES / 2 ? 0 : LATENCY_REPORT_NO_SAMPLE;
+    }
+
+    const std::vector<RankLateness> stragglers = StragglerDetector::findStragglers(reports, 2.0);
+    HCL_TEST_CHECK(stragglers.size() == 1);
+    HCL_TEST_CHECK(stragglers[0].rank == 1);
+    HCL_TEST_CHECK(stragglers[0].collectives == LATENCY_REPORT_COLLECTIVES / 2);
+    return true;
+}
+
+static bool testProcessReports()
+{
+    // Reports of windows ahead of a rank that never reports evict the oldest windows, and stall reports are accepted
+    StragglerDetector detector(2.0);
+    detector.setCommSize(2);
+
+    std::vector<LatencyReportMessage> reports = makeReports(2, 1000);
+    for (uint64_t window = 0; window < StragglerDetector::MAX_OPEN_WINDOWS * 2; window++)
+    {
+        reports[0].window = window;
+        detector.processReport(reports[0]);
+    }
+
+    reports[1].stalled = true;
+    detector.processReport(reports[1]);
+    detector.processReport(reports[1]);
+
+    reports[1].rank = 2;  // out of the comm
+    detector.processReport(reports[1]);
+    return true;
+}
+
+int main()
+{
+    unsigned failures = 0;
+
+    HCL_TEST_RUN(testNoStragglers, failures);
+    HCL_TEST_RUN(testLateRank, failures);
+    HCL_TEST_RUN(testMostOftenLateFirst, failures);
+    HCL_TEST_RUN(testThresholds, failures);
+    HCL_TEST_RUN(testMissingSamples, failures);
+    HCL_TEST_RUN(testProcessReports, failures);
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+#include "hccl/topology_rank_order.h"
+
+#include <algorithm>  // for sort
+#include <vector>     // for vector
+
+#include "hcl_test.h"
+
+static constexpr uint32_t BOX_SIZE = 8;
+
+// Two NUMA nodes per box, each serving half of the modules through its host NIC
+static RankLocation makeLocation(const std::string& hostname, uint32_t module)
+{
+    return {hostname, module, module < BOX_SIZE / 2 ? 0 : 1};
+}
+
+static bool isPermutation(const std::vector<HCL_Rank>& order, size_t size)
+{
+    std::vector<HCL_Rank> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    for (HCL_Rank rank = 0; rank < size; rank++)
+    {
+        if (rank >= sorted.size() || sorted[rank] != rank) return false;
+    }
+    return sorted.size() == size;
+}
+
+static bool testLayoutOrderKept()
+{
+    // A launcher that already places ranks box by box and module by module
+    std::vector<RankLocation> locations;
+    for (uint32_t box = 0; box < 2; box++)
+    {
+        for (uint32_t module = 0; module < BOX_SIZE; module++)
+        {
+            locations.push_back(makeLocation("host" + std::to_string(box), module));
+        }
+    }
+
+    const std::vector<HCL_Rank> order = getTopologyRankOrder(locations);
+    HCL_TEST_CHECK(isPermutation(order, locations.size()));
+    for (HCL_Rank rank = 0; rank < order.size(); rank++)
+    {
+        HCL_TEST_CHECK(order[rank] == rank);
+    }
+    return true;
+}
+
+static bool testRoundRobinLaunch()
+{
+    // Ranks spread round robin over the hosts, with modules in reverse: every neighbour pair crosses scale-out
+    const std::vector<std::string> hosts = {"b", "a", "c"};
+    std::vector<RankLocation>      locations;
+    for (uint32_t i = 0; i < hosts.size() * BOX_SIZE; i++)
+    {
+        locations.push_back(makeLocation(hosts[i % hosts.size()], BOX_SIZE - 1 - i / hosts.size()));
+    }
+
+    const std::vector<HCL_Rank> order = getTopologyRankOrder(locations);
+    HCL_TEST_CHECK(isPermutation(order, locations.size()));
+    HCL_TEST_CHECK(isOrderBoxAligned(order, locations, BOX_SIZE));
+
+    for (HCL_Rank topologyRank = 0; topologyRank < order.size(); topologyRank++)
+    {
+        const RankLocation& location = locations[order[topologyRank]];
+
+        // Hosts keep the order of their lowest rank, not the hostname order
+        HCL_TEST_CHECK(location.hostname == hosts[topologyRank / BOX_SIZE]);
+
+        // Scale-out peers are on the same module in every box
+        HCL_TEST_CHECK(location.hwModuleId == topologyRank % BOX_SIZE);
+    }
+    return true;
+}
+
+static bool testNicNumaFirst()
+{
+    // Modules whose host NIC is on the same NUMA node are grouped ahead of the module ID
+    std::vector<RankLocation> locations;
+    for (uint32_t module = 0; module < BOX_SIZE; module++)
+    {
+        locations.push_back({"host", module, module % 2 == 0 ? 1 : 0});
+    }
+
+    const std::vector<HCL_Rank> order = getTopologyRankOrder(locations);
+    HCL_TEST_CHECK((order == std::vector<HCL_Rank> {1, 3, 5, 7, 0, 2, 4, 6}));
+    return true;
+}
+
+static bool testNoHostNic()
+{
+    // Ranks without a host NIC (-1) go first in the box, ties keep the current order
+    std::vector<RankLocation> locations = {{"host", 2, 0}, {"host", 1, -1}, {"host", 2, 0}, {"host", 0, -1}};
+
+    const std::vector<HCL_Rank> order = getTopologyRankOrder(locations);
+    HCL_TEST_CHECK((order == std::vector<HCL_Rank> {3, 1, 0, 2}));
+    return true;
+}
+
+static bool testUnevenHosts()
+{
+    // A host with fewer ranks than a box shifts the following scale-up groups across hosts
+    std::vector<RankLocation> locations;
+    for (uint32_t module = 0; module < BOX_SIZE - 2; module++)
+    {
+        locations.push_back(makeLocation("small", module));
+    }
+    for (uint32_t module = 0; module < BOX_SIZE; module++)
+    {
+        locations.push_back(makeLocation("full", module));
+    }
+
+    const std::vector<HCL_Rank> order = getTopologyRankOrder(locations);
+    HCL_TEST_CHECK(isPermutation(order, locations.size()));
+    HCL_TEST_CHECK(!isOrderBoxAligned(order, locations, BOX_SIZE));
+    HCL_TEST_CHECK(isOrderBoxAligned(order, locations, 2));
+    HCL_TEST_CHECK(!isOrderBoxAligned(order, locations, 0));
+    return true;
+}
+
+static bool testEmpty()
+{
+    HCL_TEST_CHECK(getTopologyRankOrder({}).empty());
+    HCL_TEST_CHECK(isOrderBoxAligned({}, {}, BOX_SIZE));
+    return true;
+}
+
+int main()
+{
+    unsigned failures = 0;
+
+    HCL_TEST_RUN(testLayoutOrderKept, failures);
+    HCL_TEST_RUN(testRoundRobinLaunch, failures);
+    HCL_TEST_RUN(testNicNumaFirst, failures);
+    HCL_TEST_RUN(testNoHostNic, failures);
+    HCL_TEST_RUN(testUnevenHosts, failures);
+    HCL_TEST_RUN(testEmpty, failures);
+
+    return failures == 0 ? 0 : 1;
+}